@@ -0,0 +1,294 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "IRaw.h"
+
+/// <summary>
+/// Layout of a PE32 image, selects the views for 32bit files at compile time.
+/// </summary>
+struct Pe32
+{
+	/// <summary>
+	/// Width of virtual addresses and of the fields which hold them.
+	/// </summary>
+	using Address = unsigned int;
+
+	static constexpr bool Is64Bit = false;
+	static constexpr unsigned short Magic = 0x010B;
+
+	/// <summary>
+	/// Import thunks with this bit import by ordinal.
+	/// </summary>
+	static constexpr Address OrdinalFlag = 0x80000000;
+};
+
+/// <summary>
+/// Layout of a PE32+ image, selects the views for 64bit files at compile time.
+/// </summary>
+struct Pe64
+{
+	/// <summary>
+	/// Width of virtual addresses and of the fields which hold them.
+	/// </summary>
+	using Address = unsigned long long;
+
+	static constexpr bool Is64Bit = true;
+	static constexpr unsigned short Magic = 0x020B;
+
+	/// <summary>
+	/// Import thunks with this bit import by ordinal.
+	/// </summary>
+	static constexpr Address OrdinalFlag = 0x8000000000000000;
+};
+
+/// <summary>
+/// Read-only view over the optional header of one architecture.
+/// Every offset and width is a compile time constant, so a field read is a single fixed-size load.
+/// </summary>
+/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+template <typename Architecture>
+class OptionalHeaderView
+{
+public:
+	using Address = typename Architecture::Address;
+
+	/// <summary>
+	/// Constructor, the magic of the header has to match the architecture.
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="offset">Location of the optional header</param>
+	OptionalHeaderView(const std::shared_ptr<IRaw>& bFile, const long& offset) : bFile(bFile), offset(offset)
+	{
+		if (WRONG_LONG(this->offset))
+			THROW_EXCEPTION("[ERROR] offset value is wrong.");
+		if (Magic() != Architecture::Magic)
+			THROW_EXCEPTION("[ERROR] optional header magic doesn't match the architecture.");
+	}
+
+	auto Magic() const -> unsigned short { return Get<unsigned short>(0x0000); }
+	auto MajorLinkerVersion() const -> byte { return Get<byte>(0x0002); }
+	auto MinorLinkerVersion() const -> byte { return Get<byte>(0x0003); }
+	auto SizeOfCode() const -> unsigned int { return Get<unsigned int>(0x0004); }
+	auto SizeOfInitializedData() const -> unsigned int { return Get<unsigned int>(0x0008); }
+	auto SizeOfUninitializedData() const -> unsigned int { return Get<unsigned int>(0x000C); }
+	auto AddressOfEntryPoint() const -> unsigned int { return Get<unsigned int>(0x0010); }
+	auto BaseOfCode() const -> unsigned int { return Get<unsigned int>(0x0014); }
+
+	/// <summary>
+	/// BaseOfData only exists in PE32, PE32+ uses its place for the wider ImageBase.
+	/// </summary>
+	/// <returns>RVA of the data, zero for PE32+</returns>
+	auto BaseOfData() const -> unsigned int
+	{
+		if constexpr (Architecture::Is64Bit)
+			return 0;
+		else
+			return Get<unsigned int>(0x0018);
+	}
+
+	auto ImageBase() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0018 : 0x001C); }
+	auto SectionAlignment() const -> unsigned int { return Get<unsigned int>(0x0020); }
+	auto FileAlignment() const -> unsigned int { return Get<unsigned int>(0x0024); }
+	auto MajorOperatingSystemVersion() const -> unsigned short { return Get<unsigned short>(0x0028); }
+	auto MinorOperatingSystemVersion() const -> unsigned short { return Get<unsigned short>(0x002A); }
+	auto MajorImageVersion() const -> unsigned short { return Get<unsigned short>(0x002C); }
+	auto MinorImageVersion() const -> unsigned short { return Get<unsigned short>(0x002E); }
+	auto MajorSubsystemVersion() const -> unsigned short { return Get<unsigned short>(0x0030); }
+	auto MinorSubsystemVersion() const -> unsigned short { return Get<unsigned short>(0x0032); }
+	auto Win32VersionValue() const -> unsigned int { return Get<unsigned int>(0x0034); }
+	auto SizeOfImage() const -> unsigned int { return Get<unsigned int>(0x0038); }
+	auto SizeOfHeaders() const -> unsigned int { return Get<unsigned int>(0x003C); }
+	auto CheckSum() const -> unsigned int { return Get<unsigned int>(0x0040); }
+	auto Subsystem() const -> unsigned short { return Get<unsigned short>(0x0044); }
+	auto DllCharacteristics() const -> unsigned short { return Get<unsigned short>(0x0046); }
+	auto SizeOfStackReserve() const -> Address { return Get<Address>(0x0048); }
+	auto SizeOfStackCommit() const -> Address { return Get<Address>(0x0048 + sizeof(Address)); }
+	auto SizeOfHeapReserve() const -> Address { return Get<Address>(0x0048 + 2 * sizeof(Address)); }
+	auto SizeOfHeapCommit() const -> Address { return Get<Address>(0x0048 + 3 * sizeof(Address)); }
+	auto LoaderFlags() const -> unsigned int { return Get<unsigned int>(0x0048 + 4 * sizeof(Address)); }
+	auto NumberOfRvaAndSizes() const -> unsigned int { return Get<unsigned int>(0x004C + 4 * sizeof(Address)); }
+
+	/// <summary>
+	/// RVA of a data directory.
+	/// </summary>
+	/// <param name="type">Data directory</param>
+	/// <returns>RVA</returns>
+	auto DataDirectoryVirtualAddress(const DataDirectoryType& type) const -> unsigned int
+	{
+		return Get<unsigned int>(dataDirectoryOffset + static_cast<long>(type) * 8);
+	}
+
+	/// <summary>
+	/// Size of a data directory.
+	/// </summary>
+	/// <param name="type">Data directory</param>
+	/// <returns>Size</returns>
+	auto DataDirectorySize(const DataDirectoryType& type) const -> unsigned int
+	{
+		return Get<unsigned int>(dataDirectoryOffset + static_cast<long>(type) * 8 + 4);
+	}
+
+	/// <summary>
+	/// Location of the optional header.
+	/// </summary>
+	/// <returns>Offset</returns>
+	auto Offset() const -> long { return this->offset; }
+
+private:
+	// 0x0060 for PE32, 0x0070 for PE32+
+	static constexpr long dataDirectoryOffset = 0x0050 + 4 * sizeof(Address);
+
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	long offset;
+
+	// functions
+	template <typename T>
+	auto Get(const long& field) const -> T { return this->bFile->template Read<T>(this->offset + field); }
+};
+
+/// <summary>
+/// Read-only view over IMAGE_TLS_DIRECTORY32 or IMAGE_TLS_DIRECTORY64 with compile time offsets.
+/// </summary>
+/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+template <typename Architecture>
+class TlsDirectoryView
+{
+public:
+	using Address = typename Architecture::Address;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="offset">Location of the TLS directory</param>
+	TlsDirectoryView(const std::shared_ptr<IRaw>& bFile, const long& offset) : bFile(bFile), offset(offset)
+	{
+		if (WRONG_LONG(this->offset))
+			THROW_EXCEPTION("[ERROR] offset value is wrong.");
+	}
+
+	auto StartAddressOfRawData() const -> Address { return Get<Address>(0); }
+	auto EndAddressOfRawData() const -> Address { return Get<Address>(sizeof(Address)); }
+	auto AddressOfIndex() const -> Address { return Get<Address>(2 * sizeof(Address)); }
+	auto AddressOfCallBacks() const -> Address { return Get<Address>(3 * sizeof(Address)); }
+	auto SizeOfZeroFill() const -> unsigned int { return Get<unsigned int>(4 * sizeof(Address)); }
+	auto Characteristics() const -> unsigned int { return Get<unsigned int>(4 * sizeof(Address) + 4); }
+
+private:
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	long offset;
+
+	// functions
+	template <typename T>
+	auto Get(const size_t& field) const -> T { return this->bFile->template Read<T>(this->offset + static_cast<long>(field)); }
+};
+
+/// <summary>
+/// Read-only view over the security fields of IMAGE_LOAD_CONFIG_DIRECTORY32 or IMAGE_LOAD_CONFIG_DIRECTORY64
+/// with compile time offsets. Fields past the Size of the structure read as zero, like the loader treats them.
+/// </summary>
+/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+template <typename Architecture>
+class LoadConfigDirectoryView
+{
+public:
+	using Address = typename Architecture::Address;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="offset">Location of the load config directory</param>
+	LoadConfigDirectoryView(const std::shared_ptr<IRaw>& bFile, const long& offset) : bFile(bFile), offset(offset)
+	{
+		if (WRONG_LONG(this->offset))
+			THROW_EXCEPTION("[ERROR] offset value is wrong.");
+	}
+
+	auto Size() const -> unsigned int { return this->bFile->template Read<unsigned int>(this->offset); }
+	auto TimeDateStamp() const -> unsigned int { return Get<unsigned int>(0x0004); }
+	auto SecurityCookie() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0058 : 0x003C); }
+
+	/// <summary>
+	/// SafeSEH handler table, only PE32 images have one.
+	/// </summary>
+	auto SEHandlerTable() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0060 : 0x0040); }
+	auto SEHandlerCount() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0068 : 0x0044); }
+
+	auto GuardCFCheckFunctionPointer() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0070 : 0x0048); }
+	auto GuardCFDispatchFunctionPointer() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0078 : 0x004C); }
+	auto GuardCFFunctionTable() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0080 : 0x0050); }
+	auto GuardCFFunctionCount() const -> Address { return Get<Address>(Architecture::Is64Bit ? 0x0088 : 0x0054); }
+	auto GuardFlags() const -> unsigned int { return Get<unsigned int>(Architecture::Is64Bit ? 0x0090 : 0x0058); }
+
+private:
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	long offset;
+
+	// functions
+	template <typename T>
+	auto Get(const long& field) const -> T
+	{
+		if (static_cast<unsigned long long>(field) + sizeof(T) > Size())
+			return 0;
+		return this->bFile->template Read<T>(this->offset + field);
+	}
+};
+
+/// <summary>
+/// Read-only view over one IMAGE_THUNK_DATA32 or IMAGE_THUNK_DATA64 of an import lookup table.
+/// </summary>
+/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+template <typename Architecture>
+class ImportThunkView
+{
+public:
+	using Address = typename Architecture::Address;
+
+	/// <summary>
+	/// Size of one thunk, the distance to the next one in the table.
+	/// </summary>
+	static constexpr size_t Size = sizeof(Address);
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="offset">Location of the thunk</param>
+	ImportThunkView(const std::shared_ptr<IRaw>& bFile, const long& offset) :
+		addressOfData(bFile->template Read<Address>(offset))
+	{
+	}
+
+	/// <summary>
+	/// Raw thunk value, zero ends the table.
+	/// </summary>
+	auto AddressOfData() const -> Address { return this->addressOfData; }
+
+	/// <summary>
+	/// Does the thunk import by ordinal instead of by name?
+	/// </summary>
+	auto ByOrdinal() const -> bool { return (this->addressOfData & Architecture::OrdinalFlag) != 0; }
+
+	/// <summary>
+	/// Ordinal of an import by ordinal.
+	/// </summary>
+	auto Ordinal() const -> unsigned short { return static_cast<unsigned short>(this->addressOfData); }
+
+	/// <summary>
+	/// RVA of the IMAGE_IMPORT_BY_NAME of an import by name.
+	/// </summary>
+	auto HintNameRva() const -> unsigned int { return static_cast<unsigned int>(this->addressOfData); }
+
+private:
+	// variables
+	Address addressOfData;
+};
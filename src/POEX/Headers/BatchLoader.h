@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "LazyFile.h"
+#include <functional>
+#include <deque>
+
+/// <summary>
+/// Load many files from one thread for scanning.
+/// The header pages of a window of files are read together through io_uring, each file is parsed as soon
+/// as its bytes arrive and only the pages of the requested data directories are read next. Every file is
+/// handed out as a LazyFile with those pages already in its cache, so parsing it doesn't block on I/O.
+/// Without io_uring (other systems, old kernels or when it is disabled) the reads of the window are
+/// announced with posix_fadvise and done with pread, on Windows the files are read on demand.
+/// </summary>
+class BatchLoader
+{
+public:
+	/// <summary>
+	/// Receives every file which could be read, in the order the reads complete.
+	/// </summary>
+	using Callback = std::function<void(const std::filesystem::path& filepath, const std::shared_ptr<LazyFile>& file)>;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="directories">Data directories which are read ahead besides the headers</param>
+	/// <param name="queueDepth">Maximum number of reads in flight, also the number of files open at once</param>
+	/// <param name="cachedPages">Page cache size of each LazyFile, nothing more is read ahead per file</param>
+	BatchLoader(const std::vector<DataDirectoryType>& directories = {}, const unsigned int& queueDepth = 64,
+		const size_t& cachedPages = 64);
+
+	BatchLoader(const BatchLoader&) = delete;
+	auto operator=(const BatchLoader&)->BatchLoader& = delete;
+
+	/// Destructor, release the ring
+	~BatchLoader();
+
+	/// <summary>
+	/// Read the files and pass each of them to the callback.
+	/// Files which aren't PE files are still passed on, parsing them fails as usual.
+	/// </summary>
+	/// <param name="files">Paths of the files</param>
+	/// <param name="callback">Called on this thread for every file</param>
+	/// <returns>Files which couldn't be opened or read</returns>
+	auto Load(const std::vector<std::filesystem::path>& files, const Callback& callback)->std::vector<std::filesystem::path>;
+
+	/// <summary>
+	/// Are the reads done through io_uring? Turns false when the ring failed and had to be closed.
+	/// </summary>
+	auto UsesIoUring() const->bool;
+
+private:
+	/// <summary>
+	/// File which is being loaded
+	/// </summary>
+	struct Pending
+	{
+		std::filesystem::path filepath;
+		std::shared_ptr<LazyFile> file;
+		std::vector<size_t> requested;
+		unsigned int reads = 0;
+		bool failed = false;
+	};
+
+	/// <summary>
+	/// One read of consecutive pages
+	/// </summary>
+	struct Read
+	{
+		Pending* pending = nullptr;
+		size_t offset = 0;
+		std::vector<byte> buffer;
+		long long result = 0;
+	};
+
+	struct Ring;
+
+	// variables
+	std::vector<DataDirectoryType> directories;
+	unsigned int queueDepth;
+	size_t cachedPages;
+	std::unique_ptr<Ring> ring;
+	std::deque<std::unique_ptr<Read>> queued;
+	std::vector<std::unique_ptr<Read>> inFlight;
+
+	// functions
+	auto Plan(Pending& pending)->std::vector<size_t>;
+	auto Missing(Pending& pending, const long long& offset, const long long& size, std::vector<size_t>& pages)->void;
+	auto Submit()->void;
+	auto Wait()->std::vector<std::unique_ptr<Read>>;
+	auto Drain() noexcept->void;
+};
@@ -7,19 +7,42 @@
 */
 
 #include "IRaw.h"
+#include <cstring>
 
 /// <summary>
 /// Raw data parser based on IRaw abstract object
 /// </summary>
-class BufferFile : IRaw
+class BufferFile : public IRaw
 {
 public:
 	/// <summary>
-	/// Constructor as bytes array
+	/// Constructor as bytes array, the data is copied
 	/// </summary>
 	/// <param name="data">data as bytes array</param>
 	explicit BufferFile(const std::vector<byte>& data);
 
+	/// <summary>
+	/// Constructor as bytes array, take the ownership of data without copying it
+	/// </summary>
+	/// <param name="data">data as bytes array</param>
+	explicit BufferFile(std::vector<byte>&& data);
+
+	/// <summary>
+	/// Constructor as borrowed memory, the data is not copied.
+	/// The caller must keep the memory alive and unchanged while this object uses it.
+	/// The data is copied only on the first write.
+	/// </summary>
+	/// <param name="data">Pointer to the first byte</param>
+	/// <param name="length">Length of data</param>
+	BufferFile(const byte* data, const size_t& length);
+
+	/// <summary>
+	/// Constructor as shared bytes array, the data is not copied.
+	/// The data is copied only on the first write.
+	/// </summary>
+	/// <param name="data">data as shared bytes array</param>
+	explicit BufferFile(const std::shared_ptr<const std::vector<byte>>& data);
+
 	/// <summary>
 	/// Constructor as current object
 	/// </summary>
@@ -39,6 +62,15 @@ public:
 	/// <returns>Array of bytes</returns>
 	auto SubArray(const long& offset, const int& length)->std::vector<byte> override;
 
+	/// <summary>
+	/// Copy a range of data into a caller buffer, the whole range is checked once
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="destination">Buffer which receives the bytes</param>
+	/// <param name="length">Number of bytes to copy</param>
+	/// <returns></returns>
+	auto ReadBytes(const long& offset, byte* destination, const size_t& length)->void override;
+
 	/// <summary>
 	/// Read single byte
 	/// </summary>
@@ -76,7 +108,7 @@ public:
 	auto WriteByte(const long& offset, const byte& value)-> void override;
 
 	/// <summary>
-	/// Write array of bytes in specified offset
+	/// Write array of bytes in specified offset, overwriting the existing bytes
 	/// </summary>
 	/// <param name="offset">Location of start writing</param>
 	/// <param name="bytes">Array of byte that want to write</param>
@@ -130,10 +162,11 @@ public:
 	auto ReadAsciiString(const long& offset)->std::string override;
 
 	/// <summary>
-	/// Retrieve data
+	/// Retrieve data without copying it.
+	/// The view is valid until the data is modified or the object is destroyed.
 	/// </summary>
-	/// <returns>Array of data as vector</returns>
-	auto Data()->std::vector<byte> override;
+	/// <returns>View over the whole data</returns>
+	auto Data()->ByteView override;
 
 	/// <summary>
 	/// Size of data
@@ -159,20 +192,45 @@ public:
 	}
 
 	template <typename T>
-	static T BytesArrayTo(std::vector<byte> input, int offset = 0)
+	static T BytesArrayTo(const std::vector<byte>& input, int offset = 0)
 	{
-		if (input.size() < sizeof(T))
+		if (offset < 0 || input.size() < offset + sizeof(T))
 			THROW_EXCEPTION("[ERROR] Conversion fail.");
-		T* t = reinterpret_cast<T*>(input.data() + offset);
-		return (*t);
+		T t;
+		std::memcpy(&t, input.data() + offset, sizeof(T));
+		return t;
 	}
 
 private:
 	BufferFile() = default;
 	BufferFile(BufferFile&&) = default;
 
+	// variables
 	std::vector<byte> data;
+	std::shared_ptr<const void> borrowed;
+	const byte* view = nullptr;
+	size_t length = 0;
+
+	// functions
+	template <typename T>
+	auto ReadValue(const long& offset) const -> T
+	{
+		CheckRange(offset, sizeof(T));
+		T t;
+		std::memcpy(&t, this->view + offset, sizeof(T));
+		return t;
+	}
+
+	template <typename T>
+	auto WriteValue(const long& offset, const T& value) -> void
+	{
+		CheckRange(offset, sizeof(T));
+		Own();
+		std::memcpy(this->data.data() + offset, &value, sizeof(T));
+		Written(offset, sizeof(T));
+	}
 
-	auto GetSubVector(const std::vector<byte>& vec, const long& start, const long& end)->std::vector<byte>;
+	auto CheckRange(const long& offset, const size_t& size) const->void;
+	auto Own()->void;
 };
 
@@ -6,10 +6,24 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-#include <vcruntime_exception.h>
 #include <stdexcept>
 
-#define THROW_EXCEPTION(_x_) throw std::exception(_x_)
+#ifdef _WIN32
+#include <guiddef.h>
+#else
+/// <summary>
+/// Globally unique identifier, laid out as the Windows GUID.
+/// </summary>
+typedef struct _GUID
+{
+	unsigned int Data1;
+	unsigned short Data2;
+	unsigned short Data3;
+	unsigned char Data4[8];
+} GUID;
+#endif
+
+#define THROW_EXCEPTION(_x_) throw std::runtime_error(_x_)
 #define THROW_OUT_OF_RANGE(_x_) throw std::out_of_range(_x_)
 #define THROW_RUNTIME(_x_) throw std::runtime_error(_x_)
 
@@ -30,6 +44,21 @@
 #define ORDINAL_MASK_64 0x7FFFFFFFFFFFFFFF
 #define ORDINAL_MASK_86 0x7FFFFFFF
 
+// Base relocation types, the same values as winnt.h
+#ifndef IMAGE_REL_BASED_ABSOLUTE
+#define IMAGE_REL_BASED_ABSOLUTE 0
+#define IMAGE_REL_BASED_HIGH 1
+#define IMAGE_REL_BASED_LOW 2
+#define IMAGE_REL_BASED_HIGHLOW 3
+#define IMAGE_REL_BASED_HIGHADJ 4
+#define IMAGE_REL_BASED_MACHINE_SPECIFIC_5 5
+#define IMAGE_REL_BASED_RESERVED 6
+#define IMAGE_REL_BASED_MACHINE_SPECIFIC_7 7
+#define IMAGE_REL_BASED_MACHINE_SPECIFIC_8 8
+#define IMAGE_REL_BASED_MACHINE_SPECIFIC_9 9
+#define IMAGE_REL_BASED_DIR64 10
+#endif
+
 /// <summary> 
 /// File type architecture also Constants for the Optional header magic property.
 /// </summary>
@@ -51,6 +80,84 @@ enum class FileType : unsigned short
 	ROM = 0x107
 };
 
+/// <summary>
+/// How the PE file is brought into memory when opened from a path.
+/// </summary>
+enum class FileAccessType : unsigned char
+{
+	/// <summary>
+	/// Read the whole file into an owned buffer (read, write).
+	/// </summary>
+	Buffered = 0x00,
+
+	/// <summary>
+	/// Map the file read-only into memory, pages are loaded on first touch.
+	/// Edits are kept in memory as patches and only reach the disk by SaveFile.
+	/// </summary>
+	Mapped = 0x01,
+
+	/// <summary>
+	/// Read the file on demand in 4 KiB pages, only the touched bytes are read.
+	/// Good for header-only queries over slow storage. Edits are kept in memory as patches.
+	/// </summary>
+	Lazy = 0x02
+};
+
+/// <summary>
+/// How PE::SaveFile writes back to the file the PE was opened from.
+/// Saving to another file always writes the whole data.
+/// </summary>
+enum class SaveMode : unsigned char
+{
+	/// <summary>
+	/// Write only the changed ranges into the file. Falls back to Replace when the size changed.
+	/// </summary>
+	InPlace = 0x00,
+
+	/// <summary>
+	/// Write a temporary file next to it and rename it over the file, readers never see a partial save.
+	/// Unchanged ranges are cloned from the file inside the kernel, the changed ones written from memory.
+	/// </summary>
+	Replace = 0x01
+};
+
+/// <summary>
+/// How PE::Parse reacts to malformed structures.
+/// </summary>
+enum class ParseMode : unsigned char
+{
+	/// <summary>
+	/// Throw on the first malformed structure.
+	/// </summary>
+	Strict = 0x00,
+
+	/// <summary>
+	/// Never throw for malformed structures, skip them and record a ParseError in the diagnostics instead.
+	/// </summary>
+	Tolerant = 0x01
+};
+
+/// <summary>
+/// Problem found while parsing in ParseMode::Tolerant
+/// </summary>
+enum class ParseError : unsigned char
+{
+	/// <summary>
+	/// DOS, NT or optional header or the section table is out of the data.
+	/// </summary>
+	InvalidHeader = 0x01,
+
+	/// <summary>
+	/// RVA which isn't in any section.
+	/// </summary>
+	RvaNotMapped = 0x02,
+
+	/// <summary>
+	/// Table or entry which runs past the end of the data.
+	/// </summary>
+	OutOfRange = 0x03
+};
+
 /// <summary>
 /// Machine type of image
 /// </summary>
@@ -728,4 +835,65 @@ enum class SectionFlag : unsigned int
     /// Section is write-able.
     /// </summary>
     MemWrite = 0x80000000
-};
\ No newline at end of file
+};
+
+/// <summary>
+/// Operation of an x64 UNWIND_CODE.
+/// </summary>
+enum class UnwindOperation : unsigned char
+{
+    /// <summary>
+    /// Push a nonvolatile integer register, OperationInfo is the register.
+    /// </summary>
+    PushNonVolatile = 0x00,
+
+    /// <summary>
+    /// Allocate a large area on the stack, the size is in the next one or two slots.
+    /// </summary>
+    AllocLarge = 0x01,
+
+    /// <summary>
+    /// Allocate 8 to 128 bytes on the stack.
+    /// </summary>
+    AllocSmall = 0x02,
+
+    /// <summary>
+    /// Establish the frame pointer register at an offset of the current stack pointer.
+    /// </summary>
+    SetFramePointer = 0x03,
+
+    /// <summary>
+    /// Save a nonvolatile integer register with a MOV, the scaled offset is in the next slot.
+    /// </summary>
+    SaveNonVolatile = 0x04,
+
+    /// <summary>
+    /// Save a nonvolatile integer register with a MOV, the offset is in the next two slots.
+    /// </summary>
+    SaveNonVolatileFar = 0x05,
+
+    /// <summary>
+    /// Epilog location, UNWIND_INFO version 2 only.
+    /// </summary>
+    Epilog = 0x06,
+
+    /// <summary>
+    /// Reserved, takes three slots.
+    /// </summary>
+    SpareCode = 0x07,
+
+    /// <summary>
+    /// Save a nonvolatile XMM register with a MOVAPS, the scaled offset is in the next slot.
+    /// </summary>
+    SaveXmm128 = 0x08,
+
+    /// <summary>
+    /// Save a nonvolatile XMM register with a MOVAPS, the offset is in the next two slots.
+    /// </summary>
+    SaveXmm128Far = 0x09,
+
+    /// <summary>
+    /// Push a machine frame, used by interrupt and exception handlers.
+    /// </summary>
+    PushMachineFrame = 0x0A
+};
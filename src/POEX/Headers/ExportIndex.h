@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "ImageExportDirectory.h"
+#include <unordered_map>
+
+/// <summary>
+/// Hashed index over all exports of a module for repeated lookups.
+/// It is built once from an ImageExportDirectory and doesn't follow later edits of the file.
+/// Names come from the name pointer table, so every alias of a function finds it.
+/// Safe to share between threads.
+/// </summary>
+class ExportIndex
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="exportDirectory">Export directory to index</param>
+	explicit ExportIndex(ImageExportDirectory& exportDirectory);
+
+	// Names are views into exportNames, so the index can be moved but not copied.
+	ExportIndex(const ExportIndex&) = delete;
+	auto operator=(const ExportIndex&)->ExportIndex& = delete;
+	ExportIndex(ExportIndex&&) = default;
+	auto operator=(ExportIndex&&)->ExportIndex& = default;
+	~ExportIndex() = default;
+
+	/// <summary>
+	/// Find an export by name, an alias finds the export of the function it names.
+	/// </summary>
+	/// <param name="name">Case-sensitive function name</param>
+	/// <returns>Pointer of the export, nullptr if the name isn't exported</returns>
+	auto Find(const std::string_view& name) const->const ExportFunction*;
+
+	/// <summary>
+	/// Find an export by ordinal.
+	/// </summary>
+	/// <param name="ordinal">Biased ordinal, as imported</param>
+	/// <returns>Pointer of the export, nullptr if the ordinal isn't exported</returns>
+	auto Find(const unsigned short& ordinal) const->const ExportFunction*;
+
+	/// <summary>
+	/// All exports ordered by ordinal, including the null entries of ordinal gaps.
+	/// </summary>
+	/// <returns>List of export function as ExportFunction structure</returns>
+	auto Exports() const->const std::vector<ExportFunction>&;
+
+private:
+	// variables
+	std::vector<ExportFunction> exports;
+	std::vector<std::pair<std::string, unsigned short>> exportNames;
+	std::unordered_map<std::string_view, size_t> names;
+	unsigned int base;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "ImageExportDirectory.h"
+
+/// <summary>
+/// Export which contains or precedes an address
+/// </summary>
+struct ExportSymbol
+{
+	/// <summary>
+	/// The nearest export at or below the address.
+	/// </summary>
+	const ExportFunction* Function = nullptr;
+
+	/// <summary>
+	/// Distance of the address from the export RVA.
+	/// </summary>
+	unsigned int Displacement = 0;
+};
+
+/// <summary>
+/// Address to nearest export symbolizer over a sorted array of export RVAs, forwarders excluded.
+/// It is built once per module, is immutable afterwards and safe to share between threads.
+/// </summary>
+class ExportSymbolizer
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="exportDirectory">Export directory of the module</param>
+	explicit ExportSymbolizer(ImageExportDirectory& exportDirectory);
+
+	ExportSymbolizer(const ExportSymbolizer&) = delete;
+	auto operator=(const ExportSymbolizer&)->ExportSymbolizer& = delete;
+	ExportSymbolizer(ExportSymbolizer&&) = default;
+	auto operator=(ExportSymbolizer&&)->ExportSymbolizer& = default;
+	~ExportSymbolizer() = default;
+
+	/// <summary>
+	/// Find the export which contains or precedes a relative virtual address.
+	/// When several exports share an RVA the named one with the lowest ordinal is reported.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>The export and the displacement, or nothing if the address is below every export</returns>
+	auto Symbolize(const unsigned int& virtualAddress) const->std::optional<ExportSymbol>;
+
+	/// <summary>
+	/// Symbolized exports sorted by RVA.
+	/// </summary>
+	/// <returns>List of export function as ExportFunction structure</returns>
+	auto Exports() const->const std::vector<ExportFunction>&;
+
+private:
+	// variables
+	std::vector<ExportFunction> exports;
+	std::vector<unsigned int> addresses;
+	std::vector<unsigned int> firsts;
+};
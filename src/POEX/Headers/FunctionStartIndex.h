@@ -0,0 +1,104 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "PeModel.h"
+#include <utility>
+
+/// <summary>
+/// Source which reported a function start, the sources of one start are combined as bit flags.
+/// </summary>
+enum class FunctionSource : unsigned char
+{
+	/// <summary>
+	/// BeginAddress of a RUNTIME_FUNCTION in the exception directory (x64).
+	/// </summary>
+	ExceptionDirectory = 0x01,
+
+	/// <summary>
+	/// Export which isn't forwarded and points into an executable section.
+	/// </summary>
+	Export = 0x02,
+
+	/// <summary>
+	/// TLS callback.
+	/// </summary>
+	TlsCallback = 0x04,
+
+	/// <summary>
+	/// AddressOfEntryPoint of the optional header.
+	/// </summary>
+	EntryPoint = 0x08
+};
+
+/// <summary>
+/// Known function start
+/// </summary>
+struct FunctionStart
+{
+	/// <summary>
+	/// RVA of the function.
+	/// </summary>
+	unsigned int VirtualAddress = 0;
+
+	/// <summary>
+	/// FunctionSource flags of every source which reported the function.
+	/// </summary>
+	unsigned char Sources = 0;
+
+	/// <summary>
+	/// Was the function reported by a source?
+	/// </summary>
+	/// <param name="source">Source</param>
+	/// <returns>True if the source reported it</returns>
+	auto HasSource(const FunctionSource& source) const -> bool
+	{
+		return (this->Sources & static_cast<unsigned char>(source)) != 0;
+	}
+};
+
+/// <summary>
+/// Sorted and deduplicated RVAs of the known function starts of a PE, collected in one pass over the
+/// exception directory, the exports, the TLS callbacks and the entry point of a parsed model.
+/// It is immutable once built and safe to share between threads.
+/// </summary>
+class FunctionStartIndex
+{
+public:
+	using Iterator = std::vector<FunctionStart>::const_iterator;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="model">Parsed PE, see PE::Parse</param>
+	explicit FunctionStartIndex(const PeModel& model);
+
+	/// <summary>
+	/// Find the function which starts at a relative virtual address.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>The function start, nullptr when no function starts there</returns>
+	auto Find(const unsigned int& virtualAddress) const->const FunctionStart*;
+
+	/// <summary>
+	/// Function starts in [first, last).
+	/// </summary>
+	/// <param name="first">First relative virtual address of the range</param>
+	/// <param name="last">Relative virtual address after the range</param>
+	/// <returns>Begin and end of the function starts in the range</returns>
+	auto Range(const unsigned int& first, const unsigned int& last) const->std::pair<Iterator, Iterator>;
+
+	/// <summary>
+	/// All function starts sorted by RVA.
+	/// </summary>
+	/// <returns>List of function starts</returns>
+	auto Starts() const->const std::vector<FunctionStart>&;
+
+private:
+	// variables
+	std::vector<FunctionStart> starts;
+};
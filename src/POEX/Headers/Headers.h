@@ -6,12 +6,9 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-
-/// C Standard Library
-#include <atlstr.h>
-
 /// C++ Standard Library
 #include <string>
 #include <vector>
 #include <vector>
-#include <memory>
\ No newline at end of file
+#include <memory>
+#include <filesystem>
\ No newline at end of file
@@ -8,15 +8,49 @@
 
 #include "Headers.h"
 #include "Defines.h"
+#include <type_traits>
+#include <string_view>
+#include <cstring>
+#include <algorithm>
+#include <map>
 
 typedef unsigned char byte;
 
+/// <summary>
+/// Non-owning view over a range of bytes
+/// </summary>
+struct ByteView
+{
+	/// <summary>
+	/// Pointer to the first byte
+	/// </summary>
+	const byte* Pointer = nullptr;
+
+	/// <summary>
+	/// Number of bytes
+	/// </summary>
+	size_t Length = 0;
+
+	auto begin() const -> const byte* { return Pointer; }
+	auto end() const -> const byte* { return Pointer + Length; }
+	auto empty() const -> bool { return Length == 0; }
+	auto operator[](const size_t& index) const -> const byte& { return Pointer[index]; }
+
+	/// <summary>
+	/// Copy the viewed bytes into an owned array
+	/// </summary>
+	/// <returns>Array of bytes</returns>
+	auto ToVector() const -> std::vector<byte> { return std::vector<byte>(begin(), end()); }
+};
+
 /// <summary>
 /// Abstract object for implement Different parsers
 /// </summary>
 class IRaw
 {
 public:
+	/// Destructor
+	virtual ~IRaw() = default;
 
 	/// <summary>
 	/// Read single byte
@@ -33,6 +67,55 @@ public:
 	/// <returns>Array of bytes</returns>
 	virtual auto SubArray(const long& offset, const int& length)->std::vector<byte> = 0;
 
+	/// <summary>
+	/// Copy a range of data into a caller buffer, the whole range is checked once
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="destination">Buffer which receives the bytes</param>
+	/// <param name="length">Number of bytes to copy</param>
+	/// <returns></returns>
+	virtual auto ReadBytes(const long& offset, byte* destination, const size_t& length)->void = 0;
+
+	/// <summary>
+	/// Read a table of little-endian values with a single bounds check and copy
+	/// </summary>
+	/// <typeparam name="T">Trivially copyable element type</typeparam>
+	/// <param name="offset">Location of the first element</param>
+	/// <param name="count">Number of elements</param>
+	/// <returns>Array of elements</returns>
+	template <typename T>
+	auto ReadArray(const long& offset, const size_t& count) -> std::vector<T>
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "ReadArray needs a trivially copyable type");
+		if (count > Length() / sizeof(T))
+			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+		std::vector<T> values(count);
+		if (count != 0)
+			ReadBytes(offset, reinterpret_cast<byte*>(values.data()), count * sizeof(T));
+		return values;
+	}
+
+	/// <summary>
+	/// Read a little-endian value.
+	/// When the backend exposes its data as one contiguous block this is inlined to a single
+	/// bounds check and load, otherwise it falls back to ReadBytes.
+	/// </summary>
+	/// <typeparam name="T">Trivially copyable value type</typeparam>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Value</returns>
+	template <typename T>
+	auto Read(const long& offset) -> T
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Read needs a trivially copyable type");
+		T value;
+		if (this->contiguousData != nullptr && offset >= 0 && static_cast<size_t>(offset) <= this->contiguousLength &&
+			sizeof(T) <= this->contiguousLength - static_cast<size_t>(offset))
+			std::memcpy(&value, this->contiguousData + offset, sizeof(T));
+		else
+			ReadBytes(offset, reinterpret_cast<byte*>(&value), sizeof(T));
+		return value;
+	}
+
 	/// <summary>
 	/// read unsigned short (just 2 bytes)
 	/// </summary>
@@ -63,7 +146,7 @@ public:
 	virtual auto WriteByte(const long& offset, const byte& value) -> void = 0;
 
 	/// <summary>
-	/// Write array of bytes in specified offset
+	/// Write array of bytes in specified offset, overwriting the existing bytes
 	/// </summary>
 	/// <param name="offset">Location of start writing</param>
 	/// <param name="bytes">Array of byte that want to write</param>
@@ -117,10 +200,31 @@ public:
 	virtual auto ReadAsciiString(const long& offset)->std::string = 0;
 
 	/// <summary>
-	/// Retrieve data
+	/// Read ASCII string from data without copying it when the data is one contiguous block.
+	/// Otherwise the string is read into storage and the view refers to it.
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="storage">Receives the string when it can't be viewed in place</param>
+	/// <returns>View over the string, without the terminating null</returns>
+	auto ViewAsciiString(const long& offset, std::string& storage) -> std::string_view
+	{
+		if (this->contiguousData != nullptr && offset >= 0 && static_cast<size_t>(offset) < this->contiguousLength)
+		{
+			auto begin = reinterpret_cast<const char*>(this->contiguousData + offset);
+			auto available = this->contiguousLength - static_cast<size_t>(offset);
+			auto end = static_cast<const char*>(std::memchr(begin, 0x00, available));
+			return std::string_view(begin, end == nullptr ? available : static_cast<size_t>(end - begin));
+		}
+		storage = ReadAsciiString(offset);
+		return std::string_view(storage);
+	}
+
+	/// <summary>
+	/// Retrieve data without copying it.
+	/// The view is valid until the data is modified or the object is destroyed.
 	/// </summary>
-	/// <returns>Array of data as vector</returns>
-	virtual auto Data()->std::vector<byte> = 0;
+	/// <returns>View over the whole data</returns>
+	virtual auto Data()->ByteView = 0;
 
 	/// <summary>
 	/// Size of data
@@ -135,5 +239,130 @@ public:
 	/// <param name="length">The length of data want to remove</param>
 	/// <returns></returns>
 	virtual auto RemoveRange(const long& offset, const unsigned long length)->void = 0;
+
+	/// <summary>
+	/// Check a range against the data without throwing.
+	/// </summary>
+	/// <param name="offset">Location of the first byte</param>
+	/// <param name="length">Number of bytes</param>
+	/// <returns>True if the whole range is inside the data</returns>
+	auto InRange(const long& offset, const size_t& length) -> bool
+	{
+		auto size = Length();
+		return offset >= 0 && static_cast<size_t>(offset) <= size && length <= size - static_cast<size_t>(offset);
+	}
+
+	/// <summary>
+	/// Native descriptor of the file which holds a range of the data unmodified, at the same offsets.
+	/// Lets callers copy the range file to file inside the kernel instead of through memory.
+	/// </summary>
+	/// <param name="offset">Location of the range</param>
+	/// <param name="length">Length of the range</param>
+	/// <returns>File descriptor owned by the backend, -1 when the range isn't read from a file as is</returns>
+	virtual auto FileDescriptor(const long& offset, const size_t& length) -> int
+	{
+		return -1;
+	}
+
+	/// <summary>
+	/// Data published for the inlined Read path, empty when the backend has no contiguous block.
+	/// </summary>
+	/// <returns>View over the published block</returns>
+	auto ContiguousData() const -> ByteView
+	{
+		return ByteView{ this->contiguousData, this->contiguousLength };
+	}
+
+	/// <summary>
+	/// Watch writes to the first bytes of the data (e.g. the PE headers).
+	/// Backends report their writes, so WatchedRevision changes whenever this range is written.
+	/// </summary>
+	/// <param name="length">Number of bytes from the start of the data to watch</param>
+	/// <returns></returns>
+	auto Watch(const size_t& length) -> void
+	{
+		if (length > this->watchedLength)
+			this->watchedLength = length;
+	}
+
+	/// <summary>
+	/// Number of writes which touched the watched range so far.
+	/// </summary>
+	/// <returns>Revision of the watched range</returns>
+	auto WatchedRevision() const -> unsigned long long
+	{
+		return this->watchedRevision;
+	}
+
+	/// <summary>
+	/// Ranges written since the data was loaded or ClearDirtyRanges was called.
+	/// Ranges are disjoint and not adjacent, a resize dirties everything after its offset.
+	/// </summary>
+	/// <returns>Start offset mapped to the end offset of every range</returns>
+	auto DirtyRanges() const -> const std::map<size_t, size_t>&
+	{
+		return this->dirtyRanges;
+	}
+
+	/// <summary>
+	/// Forget the dirty ranges, e.g. after the data was saved to its file.
+	/// </summary>
+	/// <returns></returns>
+	auto ClearDirtyRanges() -> void
+	{
+		this->dirtyRanges.clear();
+	}
+
+protected:
+	/// <summary>
+	/// Publish the data as one contiguous block for the inlined Read path.
+	/// Backends must call it again whenever the block moves, and with nullptr when reads
+	/// have to go through ReadBytes.
+	/// </summary>
+	/// <param name="data">First byte of the data, or nullptr</param>
+	/// <param name="length">Length of the data</param>
+	/// <returns></returns>
+	auto Contiguous(const byte* data, const size_t& length) -> void
+	{
+		this->contiguousData = data;
+		this->contiguousLength = data == nullptr ? 0 : length;
+	}
+
+	/// <summary>
+	/// Report a write, every backend which supports writing must call it.
+	/// Updates the watched revision and the dirty ranges.
+	/// </summary>
+	/// <param name="offset">Location of the first written byte</param>
+	/// <param name="length">Number of written bytes</param>
+	/// <returns></returns>
+	auto Written(const long& offset, const size_t& length) -> void
+	{
+		if (length == 0 || offset < 0)
+			return;
+		if (static_cast<size_t>(offset) < this->watchedLength)
+			this->watchedRevision++;
+
+		// Merge the range with every range it overlaps or touches.
+		auto begin = static_cast<size_t>(offset);
+		auto end = begin + length;
+		auto range = this->dirtyRanges.upper_bound(begin);
+		if (range != this->dirtyRanges.begin() && std::prev(range)->second >= begin)
+			range = std::prev(range);
+		while (range != this->dirtyRanges.end() && range->first <= end)
+		{
+			begin = std::min(begin, range->first);
+			end = std::max(end, range->second);
+			range = this->dirtyRanges.erase(range);
+		}
+		this->dirtyRanges.emplace(begin, end);
+	}
+
+private:
+	// variables
+	const byte* contiguousData = nullptr;
+	size_t contiguousLength = 0;
+	size_t watchedLength = 0;
+	unsigned long long watchedRevision = 0;
+	std::map<size_t, size_t> dirtyRanges;
 };
 
@@ -8,6 +8,22 @@
 
 #include "BufferFile.h"
 
+/// <summary>
+/// Decoded base relocation entry.
+/// </summary>
+struct RelocationEntry
+{
+	/// <summary>
+	/// RVA of the location to patch.
+	/// </summary>
+	unsigned int VirtualAddress = 0;
+
+	/// <summary>
+	/// IMAGE_REL_BASED_* type of the patch.
+	/// </summary>
+	unsigned short Type = 0;
+};
+
 struct TypeOffset
 {
 	/// <summary>
@@ -15,7 +31,13 @@ struct TypeOffset
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset of the TypeOffset in the PE file.</param>
-	TypeOffset(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	TypeOffset(const std::shared_ptr<IRaw>& bFile, const long& offset);
+
+	/// <summary>
+	/// Create a new TypeOffset object from an already read TypeOffset word.
+	/// </summary>
+	/// <param name="value">The TypeOffset word.</param>
+	explicit TypeOffset(const unsigned short& value);
 
 	/// <summary>
 	/// The type is described in the 4 lower bits of the TypeOffset word.
@@ -23,6 +45,12 @@ struct TypeOffset
 	/// <returns>type</returns>
 	auto Type() const->std::string;
 
+	/// <summary>
+	/// The type as IMAGE_REL_BASED_* value, without resolving its name.
+	/// </summary>
+	/// <returns>type</returns>
+	auto TypeValue() const->unsigned short;
+
 	/// <summary>
 	/// The offset is described in the 12 higher bits of the TypeOffset word.
 	/// </summary>
@@ -36,8 +64,7 @@ private:
 	auto ParseType(const byte& type) const -> std::string;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	long offset;
+	unsigned short value = 0;
 };
 
 /// <summary>
@@ -54,7 +81,7 @@ public:
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset to the relocation struct in the PE file.</param>
 	/// <param name="relocationSize">Size of the complete relocation directory.</param>
-	ImageBaseRelocation(const std::shared_ptr<BufferFile>& bFile, const long& offset,
+	ImageBaseRelocation(const std::shared_ptr<IRaw>& bFile, const long& offset,
 		const unsigned int& relocationSize);
 	~ImageBaseRelocation() = default;
 
@@ -86,12 +113,25 @@ public:
 
 	auto TypeOffsets() -> std::vector<std::unique_ptr<TypeOffset>>;
 
+	/// <summary>
+	/// Entries of the block decoded into a packed array, IMAGE_REL_BASED_ABSOLUTE padding is skipped.
+	/// </summary>
+	/// <returns>List of relocations</returns>
+	auto Relocations() const -> std::vector<RelocationEntry>;
+
+	/// <summary>
+	/// Append the decoded entries of the block to an array, see Relocations().
+	/// </summary>
+	/// <param name="relocations">Array which receives the relocations</param>
+	/// <returns></returns>
+	auto Relocations(std::vector<RelocationEntry>& relocations) const -> void;
+
 private:
 	ImageBaseRelocation() = default;
 	ImageBaseRelocation(const ImageBaseRelocation&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	unsigned int relocationSize;
 };
\ No newline at end of file
@@ -19,7 +19,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset of the structure in the buffer.</param>
-	ImageBoundImport(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageBoundImport(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageBoundImport() = default;
 
 	/// <summary>
@@ -66,6 +66,6 @@ private:
 	ImageBoundImport(const ImageBoundImport&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 };
\ No newline at end of file
@@ -46,7 +46,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset of the structure in the buffer.</param>
-	ImageCertificateDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageCertificateDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageCertificateDirectory() = default;
 
 	/// <summary>
@@ -99,6 +99,6 @@ private:
 	ImageCertificateDirectory(const ImageCertificateDirectory&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 };
\ No newline at end of file
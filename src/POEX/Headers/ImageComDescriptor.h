@@ -53,7 +53,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset of the structure in the buffer.</param>
-	ImageComDescriptor(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageComDescriptor(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageComDescriptor() = default;
 
     /// <summary>
@@ -187,7 +187,7 @@ private:
 	ImageComDescriptor(const ImageComDescriptor&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
     std::shared_ptr<ImageDataDirectory> _metaData;
@@ -20,8 +20,8 @@ public:
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start specific Data Directory</param>
 	/// <param name="dataDirectoryType">Type of Data Directory</param>
-	ImageDataDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, const DataDirectoryType& dataDirectoryType);
-	ImageDataDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageDataDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, const DataDirectoryType& dataDirectoryType);
+	ImageDataDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageDataDirectory() = default;
 
 	/// <summary>
@@ -54,8 +54,8 @@ private:
 	ImageDataDirectory() = default;
 
 	// variables
-	DataDirectoryType dataDirectoryType;
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
+	DataDirectoryType dataDirectoryType;
 };
 
@@ -200,7 +200,7 @@ enum ExtendedDllCharacteristicsType : unsigned int
 /// </summary>
 struct CvInfoPdb70
 {
-    CvInfoPdb70(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+    CvInfoPdb70(const std::shared_ptr<IRaw>& bFile, const long& offset);
     ~CvInfoPdb70() = default;
 
     /// <summary>
@@ -256,7 +256,7 @@ private:
     CvInfoPdb70()=default;
     CvInfoPdb70(const CvInfoPdb70&) = default;
 
-    std::shared_ptr<BufferFile> bFile;
+    std::shared_ptr<IRaw> bFile;
     long offset;
 };
 
@@ -272,7 +272,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset to the debug structure in the PE file.</param>
-	ImageDebugDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageDebugDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageDebugDirectory() = default;
 
 	/// <summary>
@@ -414,6 +414,6 @@ private:
 	ImageDebugDirectory() = default;
 	ImageDebugDirectory(const ImageDebugDirectory&) = default;
 
-    std::shared_ptr<BufferFile> bFile;
+    std::shared_ptr<IRaw> bFile;
     long offset;
 };
\ No newline at end of file
@@ -19,7 +19,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset to the delay import descriptor.</param>
-	ImageDelayImportDescriptor(const std::shared_ptr<BufferFile>& bFile, 
+	ImageDelayImportDescriptor(const std::shared_ptr<IRaw>& bFile, 
 		const long& offset);
 	~ImageDelayImportDescriptor() = default;
 
@@ -131,6 +131,6 @@ private:
 	ImageDelayImportDescriptor(const ImageDelayImportDescriptor&) = default;
 	ImageDelayImportDescriptor() = default;
 
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 };
\ No newline at end of file
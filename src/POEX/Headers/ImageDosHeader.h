@@ -8,6 +8,33 @@
 
 #include "BufferFile.h"
 
+/// <summary>
+/// Plain copy of IMAGE_DOS_HEADER, as it is stored in the file.
+/// </summary>
+struct DosHeaderSnapshot
+{
+	unsigned short E_magic;
+	unsigned short E_cblp;
+	unsigned short E_cp;
+	unsigned short E_crlc;
+	unsigned short E_cparhdr;
+	unsigned short E_minalloc;
+	unsigned short E_maxalloc;
+	unsigned short E_ss;
+	unsigned short E_sp;
+	unsigned short E_csum;
+	unsigned short E_ip;
+	unsigned short E_cs;
+	unsigned short E_lfarlc;
+	unsigned short E_ovno;
+	unsigned short E_res[4];
+	unsigned short E_oemid;
+	unsigned short E_oeminfo;
+	unsigned short E_res2[10];
+	unsigned int E_lfanew;
+};
+static_assert(sizeof(DosHeaderSnapshot) == 0x40, "DosHeaderSnapshot must match the IMAGE_DOS_HEADER layout");
+
 /// <summary>
 /// The ImageDosHeader with which every PE file starts.
 /// </summary>
@@ -20,7 +47,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start ImageDosHeader structure</param>
-	ImageDosHeader(const std::shared_ptr<BufferFile>& bFile, const long& offset = 0x000000);
+	ImageDosHeader(const std::shared_ptr<IRaw>& bFile, const long& offset = 0x000000);
 	~ImageDosHeader() = default;
 
 	/// <summary>
@@ -270,11 +297,17 @@ public:
 	/// <returns></returns>
 	auto E_lfanew(const unsigned int& elfanew)->void;
 
+	/// <summary>
+	/// Copy the whole header with a single range check.
+	/// </summary>
+	/// <returns>Plain copy of the header</returns>
+	auto Snapshot() const->DosHeaderSnapshot;
+
 private:
 	ImageDosHeader() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
 	friend class PE;
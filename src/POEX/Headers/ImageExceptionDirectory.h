@@ -7,9 +7,31 @@
 */
 
 #include "BufferFile.h"
-#include "ImageSectionHeader.h"
+#include "SectionIndex.h"
 #include "ImageDataDirectory.h"
 
+/// <summary>
+/// Plain copy of one RUNTIME_FUNCTION entry, as it is stored in the file.
+/// </summary>
+struct RuntimeFunction
+{
+	/// <summary>
+	/// RVA Start of the function in code.
+	/// </summary>
+	unsigned int BeginAddress;
+
+	/// <summary>
+	/// RVA End of the function in code.
+	/// </summary>
+	unsigned int EndAddress;
+
+	/// <summary>
+	/// RVA of the unwind information.
+	/// </summary>
+	unsigned int UnwindInfoAddress;
+};
+static_assert(sizeof(RuntimeFunction) == 0xC, "RuntimeFunction must match the RUNTIME_FUNCTION layout");
+
 /// <summary>
 /// This struct is represents a function in the exception header for x64 applications.
 /// </summary>
@@ -19,43 +41,42 @@ struct ExceptionTable
 	/// Get RVA Start of the function in code.
 	/// </summary>
 	/// <returns></returns>
-	auto BeginAddress() const -> unsigned long;
+	auto BeginAddress() const -> unsigned int;
 
 	/// <summary>
 	/// Set RVA Start of the function in code.
 	/// </summary>
 	/// <param name="offset"></param>
 	/// <returns></returns>
-	auto BeginAddress(const unsigned long& offset) -> void;
+	auto BeginAddress(const unsigned int& offset) -> void;
 
 	/// <summary>
 	/// Get RVA End of the function in code.
 	/// </summary>
 	/// <returns></returns>
-	auto EndAddress() const -> unsigned long;
+	auto EndAddress() const -> unsigned int;
 
 	/// <summary>
 	/// Set RVA End of the function in code.
 	/// </summary>
 	/// <param name="offset"></param>
 	/// <returns></returns>
-	auto EndAddress(const unsigned long& offset) -> void;
+	auto EndAddress(const unsigned int& offset) -> void;
 
 	/// <summary>
 	/// Get Pointer to the unwind information.
 	/// </summary>
 	/// <returns></returns>
-	auto UnwInfo() const -> unsigned long;
+	auto UnwInfo() const -> unsigned int;
 
 	/// <summary>
 	/// Set Pointer to the unwind information.
 	/// </summary>
 	/// <param name="pointer">Pointer to the unwind information</param>
 	/// <returns></returns>
-	auto UnwInfo(const unsigned long& pointer) ->void;
+	auto UnwInfo(const unsigned int& pointer) ->void;
 
-    ExceptionTable(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-        const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders);
+    ExceptionTable(const std::shared_ptr<IRaw>& bFile, const long& offset);
     ~ExceptionTable() = default;
 
 private:
@@ -63,8 +84,7 @@ private:
     ExceptionTable(const ExceptionTable&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	std::vector<std::shared_ptr<ImageSectionHeader>> imageSectionHeaders;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
     friend class PE;
@@ -76,8 +96,8 @@ private:
 class ImageExceptionDirectory
 {
 public:
-	ImageExceptionDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset,
-		const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders,
+	ImageExceptionDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset,
+		const std::shared_ptr<const SectionIndex>& sectionIndex,
 		const bool& is32Bit, const unsigned int& directorySize);
 	~ImageExceptionDirectory() = default;
 
@@ -87,13 +107,19 @@ public:
 	/// <returns>list of Runtime function</returns>
 	auto GetExceptionDirectories() -> std::vector<std::unique_ptr<ExceptionTable>>;
 
+	/// <summary>
+	/// Get all Runtime Function as plain values, the whole table is read at once
+	/// </summary>
+	/// <returns>list of Runtime function</returns>
+	auto GetRuntimeFunctions() -> std::vector<RuntimeFunction>;
+
 private:
 	ImageExceptionDirectory() = default;
 	ImageExceptionDirectory(const ImageExceptionDirectory&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	std::vector<std::shared_ptr<ImageSectionHeader>> imageSectionHeaders;
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
 	long offset;
 	bool is32Bit;
 	unsigned int directorySize;
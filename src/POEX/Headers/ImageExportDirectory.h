@@ -7,8 +7,10 @@
 */
 
 #include "BufferFile.h"
-#include "ImageSectionHeader.h"
+#include "SectionIndex.h"
 #include "ImageDataDirectory.h"
+#include <string_view>
+#include <optional>
 
 struct ExportFunction
 {
@@ -63,8 +65,8 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of export directory in PE file</param>
-	ImageExportDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-		const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, std::unique_ptr<ImageDataDirectory> imageDataDirectory);
+	ImageExportDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
+		const std::shared_ptr<const SectionIndex>& sectionIndex, std::unique_ptr<ImageDataDirectory> imageDataDirectory);
 	ImageExportDirectory(const ImageExportDirectory&) = default;
 	~ImageExportDirectory() = default;
 
@@ -217,16 +219,46 @@ public:
 	/// <returns>List of export function as ExportFunction structure</returns>
 	auto GetExportFunctions()->std::vector<ExportFunction>;
 
+	/// <summary>
+	/// Read the name pointer table with the name ordinal table.
+	/// Every name is returned, so aliases of one function each come with the same index.
+	/// </summary>
+	/// <returns>Names with their unbiased index into the export address table</returns>
+	auto GetExportNames()->std::vector<std::pair<std::string, unsigned short>>;
+
+	/// <summary>
+	/// Find an export by name with a binary search over the sorted name pointer table,
+	/// only the visited names are read.
+	/// </summary>
+	/// <param name="name">Case-sensitive function name</param>
+	/// <returns>The export, or nothing if the name isn't exported</returns>
+	auto FindExport(const std::string_view& name) const->std::optional<ExportFunction>;
+
+	/// <summary>
+	/// Find an export by ordinal, reading only its entry of the export address table.
+	/// The Name is left empty since it would need a scan of the name tables.
+	/// </summary>
+	/// <param name="ordinal">Biased ordinal, as imported</param>
+	/// <returns>The export, or nothing if the ordinal isn't exported</returns>
+	auto FindExport(const unsigned short& ordinal) const->std::optional<ExportFunction>;
+
+	/// <summary>
+	/// Check whether an export address points into the export directory, i.e. to a forwarder string
+	/// </summary>
+	/// <param name="address">Export RVA</param>
+	/// <returns>True if the export is forwarded to another DLL</returns>
+	auto IsForwardedExport(const unsigned int& address) const -> bool;
+
 private:
 	ImageExportDirectory() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	std::vector<std::shared_ptr<ImageSectionHeader>> imageSectionHeaders;
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
 	std::unique_ptr<ImageDataDirectory> imageDataDirectory;
 	long offset;
 
-	auto IsForwardedExport(const unsigned int& address) -> bool;
+	auto ExportAt(const unsigned int& index, const std::string& name) const->std::optional<ExportFunction>;
 
 	friend class PE;
 };
\ No newline at end of file
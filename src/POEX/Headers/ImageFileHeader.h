@@ -8,6 +8,21 @@
 
 #include "BufferFile.h"
 
+/// <summary>
+/// Plain copy of IMAGE_FILE_HEADER, as it is stored in the file.
+/// </summary>
+struct FileHeaderSnapshot
+{
+	unsigned short Machine;
+	unsigned short NumberOfSections;
+	unsigned int TimeDateStamp;
+	unsigned int PointerToSymbolTable;
+	unsigned int NumberOfSymbols;
+	unsigned short SizeOfOptionalHeader;
+	unsigned short Characteristics;
+};
+static_assert(sizeof(FileHeaderSnapshot) == 0x14, "FileHeaderSnapshot must match the IMAGE_FILE_HEADER layout");
+
 /// <summary>
 	/// The File header contains information about the structure and properties of the PE file.
 	/// </summary>
@@ -19,7 +34,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start ImageFileHeader struct</param>
-	ImageFileHeader(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageFileHeader(const std::shared_ptr<IRaw>& bFile, const long& offset);
 
 	/// Destructor
 	~ImageFileHeader() = default;
@@ -129,11 +144,17 @@ public:
 	/// <returns></returns>
 	auto Characteristics(FileCharacteristicsType fileCharacteristicsType)->void;
 
+	/// <summary>
+	/// Copy the whole header with a single range check.
+	/// </summary>
+	/// <returns>Plain copy of the header</returns>
+	auto Snapshot() const->FileHeaderSnapshot;
+
 private:
 	ImageFileHeader() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
 	friend class PE;
@@ -7,8 +7,11 @@
 */
 
 #include "BufferFile.h"
-#include "ImageSectionHeader.h"
+#include "SectionIndex.h"
 #include "ImageDataDirectory.h"
+#include <string_view>
+#include <iterator>
+#include <optional>
 
 struct ImportFunction
 {
@@ -36,11 +39,123 @@ struct ImportFunction
 		Name(name), Dll(dll), Hint(hint), IATOffset(iatOffset) {};
 };
 
+/// <summary>
+/// Imported function decoded on demand by ImportFunctionRange.
+/// Name and Dll view the file data when it is one contiguous block and stay valid until the data is modified,
+/// otherwise they view a copy held by the iterator and stay valid until the iterator moves.
+/// </summary>
+struct ImportFunctionView
+{
+	/// <summary>
+	/// Function name, empty when imported by ordinal.
+	/// </summary>
+	std::string_view Name;
+
+	/// <summary>
+	/// DLL where the function comes from.
+	/// </summary>
+	std::string_view Dll;
+
+	/// <summary>
+	/// Function hint, or the ordinal when imported by ordinal.
+	/// </summary>
+	unsigned short Hint = 0;
+
+	/// <summary>
+	/// Offset into the Import Address Table.
+	/// </summary>
+	unsigned int IATOffset = 0;
+
+	/// <summary>
+	/// True when the function is imported by ordinal.
+	/// </summary>
+	bool ByOrdinal = false;
+
+	/// <summary>
+	/// Copy the function into an owned ImportFunction
+	/// </summary>
+	/// <returns>ImportFunction</returns>
+	auto ToImportFunction() const -> ImportFunction
+	{
+		return ImportFunction(std::string(Name), std::string(Dll), Hint, IATOffset);
+	}
+};
+
+/// <summary>
+/// Forward range over the thunks of one import descriptor.
+/// Each thunk is read and decoded only when the iterator reaches it, so stopping early costs
+/// only the thunks visited. The range must outlive its iterators.
+/// </summary>
+class ImportFunctionRange
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = ImportFunctionView;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const ImportFunctionView*;
+		using reference = const ImportFunctionView&;
+
+		/// End iterator
+		Iterator() = default;
+		Iterator(const Iterator& iterator);
+		auto operator=(const Iterator& iterator)->Iterator&;
+
+		auto operator*() const->reference;
+		auto operator->() const->pointer;
+		auto operator++()->Iterator&;
+		auto operator++(int)->Iterator;
+		auto operator==(const Iterator& iterator) const->bool;
+		auto operator!=(const Iterator& iterator) const->bool;
+
+	private:
+		Iterator(const ImportFunctionRange* range, const unsigned int& index);
+
+		// variables
+		const ImportFunctionRange* range = nullptr;
+		unsigned int index = 0;
+		ImportFunctionView current;
+		std::string name;
+		std::string dll;
+
+		// functions
+		auto Start()->void;
+		auto Decode()->void;
+		template <typename Architecture>
+		auto DecodeThunk()->void;
+
+		friend class ImportFunctionRange;
+	};
+
+	/// Empty range
+	ImportFunctionRange() = default;
+
+	auto begin() const->Iterator;
+	auto end() const->Iterator;
+
+private:
+	ImportFunctionRange(const std::shared_ptr<IRaw>& bFile, const std::shared_ptr<const SectionIndex>& sectionIndex,
+		const long& dllOffset, const long& thunkOffset, const unsigned int& iatOffset, bool is64Bit);
+
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
+	long dllOffset = -1;
+	long thunkOffset = -1;
+	unsigned int iatOffset = 0;
+	// Thunk decoder of the architecture, chosen once instead of per thunk.
+	auto (Iterator::*decode)()->void = nullptr;
+
+	friend class ImageImportDirectory;
+};
+
 class ImageImportDirectory
 {
 public:
-	ImageImportDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset,
-		const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, const unsigned int& iatVirtualSize,
+	ImageImportDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset,
+		const std::shared_ptr<const SectionIndex>& sectionIndex, const unsigned int& iatVirtualSize,
 		bool is64Bit);
 	~ImageImportDirectory() = default;
 
@@ -117,15 +232,87 @@ public:
 	/// <returns></returns>
 	auto GetImportedFunctions()->std::vector<ImportFunction>;
 
+	/// <summary>
+	/// Lazy range over the imported functions of current Directory, nothing is read until it is iterated.
+	/// </summary>
+	/// <returns>Range of ImportFunctionView</returns>
+	auto ImportedFunctions() const->ImportFunctionRange;
+
 private:
 	ImageImportDirectory() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	std::vector<std::shared_ptr<ImageSectionHeader>> imageSectionHeaders;
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
 	unsigned int iatVirtualSize;
 	long offset;
 	bool is64Bit;
 
+	// functions
+	auto ReadThunks(const long& offset, const size_t& count)->std::vector<unsigned long long>;
+
 	friend class PE;
+};
+
+/// <summary>
+/// Forward range over the import descriptors, stopping at the null descriptor.
+/// Each descriptor is read only when the iterator reaches it. The range must outlive its iterators.
+/// </summary>
+class ImportDescriptorRange
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = ImageImportDirectory;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const ImageImportDirectory*;
+		using reference = const ImageImportDirectory&;
+
+		/// End iterator
+		Iterator() = default;
+
+		auto operator*() const->reference;
+		auto operator->() const->pointer;
+		auto operator++()->Iterator&;
+		auto operator++(int)->Iterator;
+		auto operator==(const Iterator& iterator) const->bool;
+		auto operator!=(const Iterator& iterator) const->bool;
+
+	private:
+		Iterator(const ImportDescriptorRange* range, const unsigned int& index);
+
+		// variables
+		const ImportDescriptorRange* range = nullptr;
+		unsigned int index = 0;
+		std::optional<ImageImportDirectory> current;
+
+		// functions
+		auto Decode()->void;
+
+		friend class ImportDescriptorRange;
+	};
+
+	/// Empty range
+	ImportDescriptorRange() = default;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="offset">File offset of the first import descriptor</param>
+	/// <param name="iatVirtualSize">RVA of the Import Address Table directory</param>
+	ImportDescriptorRange(const std::shared_ptr<IRaw>& bFile, const std::shared_ptr<const SectionIndex>& sectionIndex,
+		const long& offset, const unsigned int& iatVirtualSize, bool is64Bit);
+
+	auto begin() const->Iterator;
+	auto end() const->Iterator;
+
+private:
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
+	long offset = -1;
+	unsigned int iatVirtualSize = 0;
+	bool is64Bit = false;
 };
\ No newline at end of file
@@ -22,7 +22,7 @@ public:
     /// <param name="peFile">A PE file.</param>
     /// <param name="offset">Offset of the structure in the buffer.</param>
     /// <param name="is64Bit">Flag if the PE file is 64 Bit.</param>
-	ImageLoadConfigDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, const bool& is64Bit);
+	ImageLoadConfigDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, const bool& is64Bit);
 	~ImageLoadConfigDirectory() = default;
 
 	/// <summary>
@@ -358,7 +358,7 @@ private:
 	ImageLoadConfigDirectory(const ImageLoadConfigDirectory&) = default;
 	ImageLoadConfigDirectory() = default;
 
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	bool is64Bit;
 };
\ No newline at end of file
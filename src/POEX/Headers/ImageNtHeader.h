@@ -21,7 +21,7 @@ public:
 	/// </summary>
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start ImgeNtHeader struct</param>
-	ImageNtHeader(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageNtHeader(const std::shared_ptr<IRaw>& bFile, const long& offset);
 	~ImageNtHeader() = default;
 
 	/// <summary>
@@ -53,7 +53,7 @@ private:
 	ImageNtHeader() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
 	friend class PE;
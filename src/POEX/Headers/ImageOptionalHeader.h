@@ -9,6 +9,54 @@
 #include "BufferFile.h"
 #include "ImageDataDirectory.h"
 
+/// <summary>
+/// Plain copy of IMAGE_OPTIONAL_HEADER32 or IMAGE_OPTIONAL_HEADER64.
+/// Fields which are 32bit in PE32 are widened, BaseOfData is zero for PE32+.
+/// </summary>
+struct OptionalHeaderSnapshot
+{
+	unsigned short Magic;
+	byte MajorLinkerVersion;
+	byte MinorLinkerVersion;
+	unsigned int SizeOfCode;
+	unsigned int SizeOfInitializedData;
+	unsigned int SizeOfUninitializedData;
+	unsigned int AddressOfEntryPoint;
+	unsigned int BaseOfCode;
+	unsigned int BaseOfData;
+	unsigned long long ImageBase;
+	unsigned int SectionAlignment;
+	unsigned int FileAlignment;
+	unsigned short MajorOperatingSystemVersion;
+	unsigned short MinorOperatingSystemVersion;
+	unsigned short MajorImageVersion;
+	unsigned short MinorImageVersion;
+	unsigned short MajorSubsystemVersion;
+	unsigned short MinorSubsystemVersion;
+	unsigned int Win32VersionValue;
+	unsigned int SizeOfImage;
+	unsigned int SizeOfHeaders;
+	unsigned int CheckSum;
+	unsigned short Subsystem;
+	unsigned short DllCharacteristics;
+	unsigned long long SizeOfStackReserve;
+	unsigned long long SizeOfStackCommit;
+	unsigned long long SizeOfHeapReserve;
+	unsigned long long SizeOfHeapCommit;
+	unsigned int LoaderFlags;
+	unsigned int NumberOfRvaAndSizes;
+
+	/// <summary>
+	/// RVA and size of the 16 data directories, indexed by DataDirectoryType.
+	/// Only the first NumberOfRvaAndSizes entries are data directories.
+	/// </summary>
+	struct
+	{
+		unsigned int VirtualAddress;
+		unsigned int Size;
+	} DataDirectory[16];
+};
+
 /// <summary>
 /// Represents the optional header in the NT header.
 /// </summary>
@@ -21,7 +69,7 @@ public:
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start optional Header</param>
 	/// <param name="is64Bit">represent is file 64bit or 32bit</param>
-	ImageOptionalHeader(const std::shared_ptr<BufferFile>& bFile, const long& offset, const bool& is64Bit);
+	ImageOptionalHeader(const std::shared_ptr<IRaw>& bFile, const long& offset, const bool& is64Bit);
 	~ImageOptionalHeader() = default;
 
 	/// <summary>
@@ -429,11 +477,17 @@ public:
 	/// <returns></returns>
 	auto NumberOfRvaAndSizes(const unsigned int& numberOfRvaAndSizes)->void;
 
+	/// <summary>
+	/// Copy the whole header, data directories included, with a single range check.
+	/// </summary>
+	/// <returns>Plain copy of the header</returns>
+	auto Snapshot() const->OptionalHeaderSnapshot;
+
 private:
 	ImageOptionalHeader() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	bool is64Bit;
 
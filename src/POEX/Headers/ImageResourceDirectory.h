@@ -9,6 +9,7 @@
 #include "BufferFile.h"
 #include "ImageSectionHeader.h"
 #include "ImageDataDirectory.h"
+#include "ResourceTree.h"
 
 class ImageResourceDirectory;
 struct ImageResourceDirectoryEntry;
@@ -135,7 +136,7 @@ struct ImageResourceDirStringU
 	/// </summary>
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Raw offset of the string.</param>
-	ImageResourceDirStringU(const std::shared_ptr<BufferFile>& bFile, const long& offset);
+	ImageResourceDirStringU(const std::shared_ptr<IRaw>& bFile, const long& offset);
 
 	/// <summary>
 	/// Length of the string in Unicode characters, *not* in bytes.
@@ -164,7 +165,7 @@ private:
 
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 
 	friend class PE;
@@ -175,7 +176,7 @@ private:
 /// </summary>
 struct ImageResourceDirectoryEntry
 {
-	ImageResourceDirectoryEntry(const std::shared_ptr<BufferFile>& bFile, 
+	ImageResourceDirectoryEntry(const std::shared_ptr<IRaw>& bFile, 
 		const std::shared_ptr<ImageResourceDirectory>& parent,
 		const long& offset, const long& resourceDirectoryOffset);
 
@@ -281,7 +282,7 @@ private:
 	ImageResourceDirectoryEntry(const ImageResourceDirectoryEntry&) = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	std::shared_ptr<ImageResourceDirectory> resourceDirectory;
 	std::shared_ptr<ImageResourceDirectory> parent;
 	std::string NameResolved;
@@ -298,10 +299,10 @@ private:
 class ImageResourceDirectory
 {
 public:
-	ImageResourceDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset,
+	ImageResourceDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset,
 		const long& resourceDirectoryOffset, const long& resourceDirectoryLength);
 
-	ImageResourceDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset,
+	ImageResourceDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset,
 		const std::shared_ptr<ImageResourceDirectoryEntry>& parent,
 		const long& resourceDirectoryOffset, const long& resourceDirectoryLength);
 
@@ -313,6 +314,12 @@ public:
 	/// <returns>List of directory entries</returns>
 	auto ImageResourceDirectoryEntries() -> std::vector<std::shared_ptr<ImageResourceDirectoryEntry>>;
 
+	/// <summary>
+	/// Decode the whole resource directory, which this directory belongs to, into one flat node array.
+	/// </summary>
+	/// <returns>Resource tree</returns>
+	auto Tree() const -> ResourceTree;
+
 	/// <summary>
 	/// Get Characteristics
 	/// </summary>
@@ -398,8 +405,9 @@ private:
 	auto SanityCheckFailed(const std::shared_ptr<ImageResourceDirectoryEntry>& entry)->bool;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
-	std::shared_ptr<ImageResourceDirectoryEntry> parent;
+	std::shared_ptr<IRaw> bFile;
+	// Weak, the parent entry owns this directory.
+	std::weak_ptr<ImageResourceDirectoryEntry> parent;
 	long offset;
 	long resourceDirectoryOffset;
 	long resourceDirectoryLength;
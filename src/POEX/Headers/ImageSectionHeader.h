@@ -8,6 +8,27 @@
 
 #include "BufferFile.h"
 
+/// <summary>
+/// Plain copy of IMAGE_SECTION_HEADER, as it is stored in the file.
+/// </summary>
+struct SectionHeaderSnapshot
+{
+	/// <summary>
+	/// Name padded with zeros, not terminated when it is 8 characters long.
+	/// </summary>
+	char Name[8];
+	unsigned int VirtualSize;
+	unsigned int VirtualAddress;
+	unsigned int SizeOfRawData;
+	unsigned int PointerToRawData;
+	unsigned int PointerToRelocations;
+	unsigned int PointerToLinenumbers;
+	unsigned short NumberOfRelocations;
+	unsigned short NumberOfLinenumbers;
+	unsigned int Characteristics;
+};
+static_assert(sizeof(SectionHeaderSnapshot) == 0x28, "SectionHeaderSnapshot must match the IMAGE_SECTION_HEADER layout");
+
 /// <summary>
 	/// This class represents the IMAGE_SECTION_HEADER structure of image
 	/// </summary>
@@ -20,7 +41,7 @@ public:
 	/// <param name="bFile">A PE file</param>
 	/// <param name="offset">Location of start</param>
 	/// <param name="imageBaseAddress">Base address of the image from the Optional header</param>
-	ImageSectionHeader(const std::shared_ptr<BufferFile>& bFile, const long& offset, const unsigned long& imageBaseAddress);
+	ImageSectionHeader(const std::shared_ptr<IRaw>& bFile, const long& offset, const unsigned long& imageBaseAddress);
 	//ImageSectionHeader(ImageSectionHeader&&) = default;
 	~ImageSectionHeader() = default;
 
@@ -177,11 +198,17 @@ public:
 	/// <returns>Array of bytes</returns>
 	auto ToArray()->std::vector<byte>;
 
+	/// <summary>
+	/// Copy the whole header with a single range check.
+	/// </summary>
+	/// <returns>Plain copy of the header</returns>
+	auto Snapshot() const->SectionHeaderSnapshot;
+
 private:
 	ImageSectionHeader() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	unsigned long imageBaseAddress;
 
@@ -7,7 +7,7 @@
 */
 
 #include "BufferFile.h"
-#include "ImageSectionHeader.h"
+#include "SectionIndex.h"
 
 /// <summary>
 /// Thread Local Storage callback.
@@ -20,7 +20,7 @@ struct ImageTlsCallback
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset to TLS structure in buffer.</param>
 	/// <param name="is64Bit">Flag if the PE file is 64 Bit.</param>
-	ImageTlsCallback(const std::shared_ptr<BufferFile>& bFile, const long& offset, const bool& is64Bit);
+	ImageTlsCallback(const std::shared_ptr<IRaw>& bFile, const long& offset, const bool& is64Bit);
 	ImageTlsCallback(const ImageTlsCallback&) = default;
 
 	/// <summary>
@@ -40,7 +40,7 @@ private:
 	ImageTlsCallback() = default;
 
 	// variables
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	bool is64Bit;
 };
@@ -58,8 +58,8 @@ public:
 	/// <param name="bFile">A PE file.</param>
 	/// <param name="offset">Offset to TLS structure in buffer.</param>
 	/// <param name="is64Bit">Flag if the PE file is 64 Bit.</param>
-	ImageTlsDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset,
-		const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, const bool& is64Bit);
+	ImageTlsDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset,
+		const std::shared_ptr<const SectionIndex>& sectionIndex, const bool& is64Bit);
 
 	auto Callbacks() -> std::vector<ImageTlsCallback>;
 
@@ -146,8 +146,8 @@ private:
 	ImageTlsDirectory(const ImageTlsDirectory&) = default;
 
 	// variables
-	std::vector<std::shared_ptr<ImageSectionHeader>> imageSectionHeaders;
-	std::shared_ptr<BufferFile> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
+	std::shared_ptr<IRaw> bFile;
 	long offset;
 	bool is64Bit;
 };
\ No newline at end of file
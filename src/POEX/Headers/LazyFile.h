@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "IRaw.h"
+#include <filesystem>
+#include <unordered_map>
+#include <list>
+#include <mutex>
+
+/// <summary>
+/// Read-only raw data parser which reads the file on demand.
+/// Data is fetched in 4 KiB pages with positional reads and the most recently used pages
+/// are kept in a small cache, so header queries only read the bytes they touch.
+/// Reads may run on several threads at once, the page cache is guarded by a mutex.
+/// </summary>
+class LazyFile : public IRaw
+{
+public:
+	/// <summary>
+	/// Size of one cached page in bytes.
+	/// </summary>
+	static constexpr size_t PageSize = 0x1000;
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="filepath">Path of the file to read</param>
+	/// <param name="cachedPages">Maximum number of pages kept in the cache</param>
+	explicit LazyFile(const std::filesystem::path& filepath, const size_t& cachedPages = 64);
+
+	LazyFile(const LazyFile&) = delete;
+	auto operator=(const LazyFile&)->LazyFile& = delete;
+
+	/// Destructor, close the file
+	~LazyFile();
+
+	/// <summary>
+	/// Get subset array from data
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of the subset</param>
+	/// <returns>Array of bytes</returns>
+	auto SubArray(const long& offset, const int& length)->std::vector<byte> override;
+
+	/// <summary>
+	/// Copy a range of data into a caller buffer, the whole range is checked once
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="destination">Buffer which receives the bytes</param>
+	/// <param name="length">Number of bytes to copy</param>
+	/// <returns></returns>
+	auto ReadBytes(const long& offset, byte* destination, const size_t& length)->void override;
+
+	/// <summary>
+	/// Read single byte
+	/// </summary>
+	/// <param name="offset">Location of byte</param>
+	/// <returns>Byte data</returns>
+	auto ReadByte(const long& offset)->byte override;
+
+	/// <summary>
+	/// read unsigned short (just 2 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned short data</returns>
+	auto ReadUnsignedShort(const long& offset)->unsigned short override;
+
+	/// <summary>
+	/// Read unsigned int (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned int data</returns>
+	auto ReadUnsignedInt(const long& offset)->unsigned int override;
+
+	/// <summary>
+	/// read unsigned long (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned long data</returns>
+	auto ReadUnsignedLong(const long& offset)->unsigned long override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto WriteByte(const long& offset, const byte& value)->void override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto WriteBytes(const long& offset, const std::vector<byte>& bytes)->void override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto WriteUnsignedShort(const long& offset, const unsigned short& value)->void override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto WriteUnsignedLong(const long& offset, const unsigned long& value)->void override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto WriteUnsignedInt(const long& offset, const unsigned int& value)->void override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset)->std::wstring override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset and length
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of string in characters</param>
+	/// <returns>Unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset, const long& length)->std::wstring override;
+
+	/// <summary>
+	/// Read ASCII string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>ASCII string as std::string</returns>
+	auto ReadAsciiString(const long& offset)->std::string override;
+
+	/// <summary>
+	/// Retrieve the whole data.
+	/// The file is read completely on the first call and kept until the object is destroyed.
+	/// It switches the reads to the whole data, so don't call it while other threads read the file.
+	/// </summary>
+	/// <returns>View over the whole data</returns>
+	auto Data()->ByteView override;
+
+	/// <summary>
+	/// Size of data
+	/// </summary>
+	/// <returns>Data length</returns>
+	auto Length()->size_t override;
+
+	/// <summary>
+	/// Not supported, the file is read-only.
+	/// </summary>
+	auto RemoveRange(const long& offset, const unsigned long length)->void override;
+
+	/// <summary>
+	/// Descriptor of the opened file, the data is never modified.
+	/// </summary>
+	/// <param name="offset">Location of the range</param>
+	/// <param name="length">Length of the range</param>
+	/// <returns>File descriptor, -1 on Windows or when the range is out of the file</returns>
+	auto FileDescriptor(const long& offset, const size_t& length)->int override;
+
+	/// <summary>
+	/// Number of bytes which were actually read from the file so far.
+	/// </summary>
+	/// <returns>Read bytes count</returns>
+	auto BytesRead() const->unsigned long long;
+
+	/// <summary>
+	/// Put data which was read elsewhere (e.g. by BatchLoader) into the page cache.
+	/// Pages which are already cached are kept, the primed ones count as the most recently used.
+	/// </summary>
+	/// <param name="offset">File offset of the data, a multiple of PageSize</param>
+	/// <param name="data">Bytes of the file at offset</param>
+	/// <param name="size">Number of bytes, a trailing partial page is dropped unless it ends the file</param>
+	auto Prime(const size_t& offset, const byte* data, const size_t& size)->void;
+
+private:
+	LazyFile() = default;
+
+	// variables
+	size_t length = 0;
+	size_t cachedPages = 0;
+	unsigned long long bytesRead = 0;
+	std::list<std::pair<size_t, std::vector<byte>>> pages;
+	std::unordered_map<size_t, std::list<std::pair<size_t, std::vector<byte>>>::iterator> pageIndex;
+	std::vector<byte> image;
+	mutable std::mutex mutex;
+#ifdef _WIN32
+	void* file = nullptr;
+#else
+	int descriptor = -1;
+#endif
+
+	// functions
+	template <typename T>
+	auto ReadValue(const long& offset) -> T
+	{
+		T t;
+		Copy(offset, reinterpret_cast<byte*>(&t), sizeof(T));
+		return t;
+	}
+
+	auto Page(const size_t& number)->const std::vector<byte>&;
+	auto FreePage()->std::vector<byte>;
+	auto Copy(const long& offset, byte* destination, const size_t& size)->void;
+	auto ReadAt(const size_t& offset, byte* destination, const size_t& size)->void;
+	auto CheckRange(const long& offset, const size_t& size) const->void;
+	auto Close()->void;
+};
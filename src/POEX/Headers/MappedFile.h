@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "IRaw.h"
+#include <filesystem>
+
+/// <summary>
+/// Read-only raw data parser based on a memory mapping of the file.
+/// Only the pages which are actually touched are read from the disk.
+/// </summary>
+class MappedFile : public IRaw
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="filepath">Path of the file to map</param>
+	explicit MappedFile(const std::filesystem::path& filepath);
+
+	MappedFile(const MappedFile&) = delete;
+	auto operator=(const MappedFile&)->MappedFile& = delete;
+
+	/// Destructor, unmap the file
+	~MappedFile();
+
+	/// <summary>
+	/// Get subset array from data
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of the subset</param>
+	/// <returns>Array of bytes</returns>
+	auto SubArray(const long& offset, const int& length)->std::vector<byte> override;
+
+	/// <summary>
+	/// Copy a range of data into a caller buffer, the whole range is checked once
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="destination">Buffer which receives the bytes</param>
+	/// <param name="length">Number of bytes to copy</param>
+	/// <returns></returns>
+	auto ReadBytes(const long& offset, byte* destination, const size_t& length)->void override;
+
+	/// <summary>
+	/// Read single byte
+	/// </summary>
+	/// <param name="offset">Location of byte</param>
+	/// <returns>Byte data</returns>
+	auto ReadByte(const long& offset)->byte override;
+
+	/// <summary>
+	/// read unsigned short (just 2 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned short data</returns>
+	auto ReadUnsignedShort(const long& offset)->unsigned short override;
+
+	/// <summary>
+	/// Read unsigned int (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned int data</returns>
+	auto ReadUnsignedInt(const long& offset)->unsigned int override;
+
+	/// <summary>
+	/// read unsigned long (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned long data</returns>
+	auto ReadUnsignedLong(const long& offset)->unsigned long override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto WriteByte(const long& offset, const byte& value)->void override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto WriteBytes(const long& offset, const std::vector<byte>& bytes)->void override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto WriteUnsignedShort(const long& offset, const unsigned short& value)->void override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto WriteUnsignedLong(const long& offset, const unsigned long& value)->void override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto WriteUnsignedInt(const long& offset, const unsigned int& value)->void override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset)->std::wstring override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset and length
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of string in characters</param>
+	/// <returns>Unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset, const long& length)->std::wstring override;
+
+	/// <summary>
+	/// Read ASCII string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>ASCII string as std::string</returns>
+	auto ReadAsciiString(const long& offset)->std::string override;
+
+	/// <summary>
+	/// Retrieve data without copying it.
+	/// The view is valid until the object is destroyed.
+	/// </summary>
+	/// <returns>View over the whole mapping</returns>
+	auto Data()->ByteView override;
+
+	/// <summary>
+	/// Size of data
+	/// </summary>
+	/// <returns>Data length</returns>
+	auto Length()->size_t override;
+
+	/// <summary>
+	/// Not supported, the mapping is read-only.
+	/// </summary>
+	auto RemoveRange(const long& offset, const unsigned long length)->void override;
+
+	/// <summary>
+	/// Descriptor of the opened file, the data is never modified.
+	/// </summary>
+	/// <param name="offset">Location of the range</param>
+	/// <param name="length">Length of the range</param>
+	/// <returns>File descriptor, -1 on Windows or when the range is out of the file</returns>
+	auto FileDescriptor(const long& offset, const size_t& length)->int override;
+
+	/// <summary>
+	/// Hint the kernel that a range will be read soon, so it can be paged in ahead of time.
+	/// Useful before walking a large table (e.g. export names) in a big file.
+	/// </summary>
+	/// <param name="offset">Location of start of the range</param>
+	/// <param name="length">Length of the range</param>
+	/// <returns></returns>
+	auto WillNeed(const long& offset, const size_t& length)->void;
+
+private:
+	MappedFile() = default;
+
+	// variables
+	const byte* data = nullptr;
+	size_t length = 0;
+#ifdef _WIN32
+	void* file = nullptr;
+	void* mapping = nullptr;
+#else
+	int descriptor = -1;
+#endif
+
+	// functions
+	auto CheckRange(const long& offset, const size_t& size) const->void;
+	auto Close()->void;
+};
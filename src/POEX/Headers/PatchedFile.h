@@ -0,0 +1,214 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "IRaw.h"
+#include <cstring>
+#include <map>
+
+/// <summary>
+/// Copy-on-write edit layer over an immutable IRaw.
+/// Writes are recorded as sparse patches (offset -> bytes) and reads resolve through them,
+/// the base is never modified. Several PatchedFile can share the same base.
+/// </summary>
+class PatchedFile : public IRaw
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="base">Data which the patches are applied on, it is never written and must not be modified elsewhere</param>
+	explicit PatchedFile(const std::shared_ptr<IRaw>& base);
+
+	PatchedFile(const PatchedFile& patchedFile);
+
+	/// Destructor
+	~PatchedFile() = default;
+
+	/// <summary>
+	/// Get subset array from data
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of the subset</param>
+	/// <returns>Array of bytes</returns>
+	auto SubArray(const long& offset, const int& length)->std::vector<byte> override;
+
+	/// <summary>
+	/// Copy a range of data into a caller buffer, the whole range is checked once
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="destination">Buffer which receives the bytes</param>
+	/// <param name="length">Number of bytes to copy</param>
+	/// <returns></returns>
+	auto ReadBytes(const long& offset, byte* destination, const size_t& length)->void override;
+
+	/// <summary>
+	/// Read single byte
+	/// </summary>
+	/// <param name="offset">Location of byte</param>
+	/// <returns>Byte data</returns>
+	auto ReadByte(const long& offset)->byte override;
+
+	/// <summary>
+	/// read unsigned short (just 2 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned short data</returns>
+	auto ReadUnsignedShort(const long& offset)->unsigned short override;
+
+	/// <summary>
+	/// Read unsigned int (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned int data</returns>
+	auto ReadUnsignedInt(const long& offset)->unsigned int override;
+
+	/// <summary>
+	/// read unsigned long (just 4 bytes)
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>Unsigned long data</returns>
+	auto ReadUnsignedLong(const long& offset)->unsigned long override;
+
+	/// <summary>
+	/// Write single byte in specified offset
+	/// </summary>
+	/// <param name="offset">Location of start writing</param>
+	/// <param name="value">Value to writing</param>
+	/// <returns></returns>
+	auto WriteByte(const long& offset, const byte& value)->void override;
+
+	/// <summary>
+	/// Write array of bytes in specified offset, overwriting the existing bytes
+	/// </summary>
+	/// <param name="offset">Location of start writing</param>
+	/// <param name="bytes">Array of byte that want to write</param>
+	/// <returns></returns>
+	auto WriteBytes(const long& offset, const std::vector<byte>& bytes)->void override;
+
+	/// <summary>
+	/// Write unsigned short (2 byte value) in specified offset
+	/// </summary>
+	/// <param name="offset">Location of start writing</param>
+	/// <param name="bytes">Data that want to write</param>
+	/// <returns></returns>
+	auto WriteUnsignedShort(const long& offset, const unsigned short& value)->void override;
+
+	/// <summary>
+	/// Write unsigned long (4 byte value) in specified offset
+	/// </summary>
+	/// <param name="offset">Location of start writing</param>
+	/// <param name="bytes">Data that want to write</param>
+	/// <returns></returns>
+	auto WriteUnsignedLong(const long& offset, const unsigned long& value)->void override;
+
+	/// <summary>
+	/// Write unsigned int (4 byte value) in specified offset
+	/// </summary>
+	/// <param name="offset">Location of start writing</param>
+	/// <param name="bytes">Data that want to write</param>
+	/// <returns></returns>
+	auto WriteUnsignedInt(const long& offset, const unsigned int& value)->void override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset)->std::wstring override;
+
+	/// <summary>
+	/// Read unicode string from data based on specified offset and length
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <param name="length">Length of string in characters</param>
+	/// <returns>Unicode string as wstring</returns>
+	auto ReadUnicodeString(const long& offset, const long& length)->std::wstring override;
+
+	/// <summary>
+	/// Read ASCII string from data based on specified offset
+	/// </summary>
+	/// <param name="offset">Location of start reading</param>
+	/// <returns>ASCII string as std::string</returns>
+	auto ReadAsciiString(const long& offset)->std::string override;
+
+	/// <summary>
+	/// Retrieve data with all patches applied.
+	/// Without patches this is the view of the base, otherwise the image is materialized once
+	/// and kept until the next write.
+	/// </summary>
+	/// <returns>View over the whole data</returns>
+	auto Data()->ByteView override;
+
+	/// <summary>
+	/// Size of data
+	/// </summary>
+	/// <returns>Data length</returns>
+	auto Length()->size_t override;
+
+	/// <summary>
+	/// Not supported, patches can't change the size of the base.
+	/// </summary>
+	auto RemoveRange(const long& offset, const unsigned long length)->void override;
+
+	/// <summary>
+	/// Descriptor of the file of the base, as long as no patch touches the range.
+	/// </summary>
+	/// <param name="offset">Location of the range</param>
+	/// <param name="length">Length of the range</param>
+	/// <returns>File descriptor, -1 when the range is patched or the base isn't a file</returns>
+	auto FileDescriptor(const long& offset, const size_t& length)->int override;
+
+	/// <summary>
+	/// Data which the patches are applied on.
+	/// </summary>
+	/// <returns>Pointer of base IRaw</returns>
+	auto Base() const->std::shared_ptr<IRaw>;
+
+	/// <summary>
+	/// Recorded patches, sorted by offset. Patches never overlap or touch each other.
+	/// </summary>
+	/// <returns>Map of offset to patched bytes</returns>
+	auto Patches() const->const std::map<long, std::vector<byte>>&;
+
+	/// <summary>
+	/// Drop all patches and go back to the base data.
+	/// </summary>
+	/// <returns></returns>
+	auto Revert()->void;
+
+private:
+	PatchedFile() = default;
+
+	// variables
+	std::shared_ptr<IRaw> base;
+	std::map<long, std::vector<byte>> patches;
+	std::vector<byte> image;
+	bool materialized = false;
+
+	// functions
+	template <typename T>
+	auto ReadValue(const long& offset) -> T
+	{
+		T t;
+		auto bytes = ReadRange(offset, sizeof(T));
+		std::memcpy(&t, bytes.data(), sizeof(T));
+		return t;
+	}
+
+	template <typename T>
+	auto WriteValue(const long& offset, const T& value) -> void
+	{
+		Patch(offset, reinterpret_cast<const byte*>(&value), sizeof(T));
+	}
+
+	auto IsPatched(const long& offset, const size_t& size) const->bool;
+	auto ReadRange(const long& offset, const size_t& size)->std::vector<byte>;
+	auto Overlay(const long& offset, byte* destination, const size_t& size) const->void;
+	auto Patch(const long& offset, const byte* bytes, const size_t& size)->void;
+	auto CheckRange(const long& offset, const size_t& size)->void;
+};
@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "ImageExceptionDirectory.h"
+#include "ImageImportDirectory.h"
+#include "ImageBaseRelocation.h"
+#include "ResourceTree.h"
+#include "SectionIndex.h"
+#include <memory_resource>
+#include <optional>
+
+/// <summary>
+/// Immutable model of a whole PE, parsed in a single pass over the headers and every data directory.
+/// In ParseMode::Tolerant malformed structures are skipped and reported by Diagnostics() instead of thrown.
+/// All tables live in one monotonic arena which is released at once with the model.
+/// ASCII names are copied into the arena as well, the model doesn't point into the file data and
+/// stays valid when the PE is written afterwards. Safe to share between threads.
+/// </summary>
+class PeModel
+{
+public:
+	/// <summary>
+	/// RVA and size of a data directory
+	/// </summary>
+	struct DataDirectory
+	{
+		unsigned int VirtualAddress = 0;
+		unsigned int Size = 0;
+	};
+
+	/// <summary>
+	/// Section header
+	/// </summary>
+	struct Section
+	{
+		std::string_view Name;
+		unsigned int VirtualAddress = 0;
+		unsigned int VirtualSize = 0;
+		unsigned int PointerToRawData = 0;
+		unsigned int SizeOfRawData = 0;
+		unsigned int Characteristics = 0;
+	};
+
+	/// <summary>
+	/// Import descriptor, its functions are ImportedFunctions()[FirstFunction, FirstFunction + FunctionCount)
+	/// </summary>
+	struct ImportModule
+	{
+		std::string_view Dll;
+		unsigned int TimeDateStamp = 0;
+		unsigned int FirstFunction = 0;
+		unsigned int FunctionCount = 0;
+	};
+
+	/// <summary>
+	/// Export, Name is empty for exports by ordinal only and ForwardedName for exports of this module
+	/// </summary>
+	struct Export
+	{
+		std::string_view Name;
+		std::string_view ForwardedName;
+		unsigned int Address = 0;
+		unsigned short Ordinal = 0;
+	};
+
+	/// <summary>
+	/// Base relocation entry, IMAGE_REL_BASED_ABSOLUTE padding is skipped
+	/// </summary>
+	using Relocation = RelocationEntry;
+
+	/// <summary>
+	/// Malformed structure found in ParseMode::Tolerant
+	/// </summary>
+	struct Diagnostic
+	{
+		ParseError Error = ParseError::OutOfRange;
+
+		/// <summary>
+		/// Data directory of the structure, empty for the headers.
+		/// </summary>
+		std::optional<DataDirectoryType> Directory;
+
+		/// <summary>
+		/// File offset of the structure, or its RVA for ParseError::RvaNotMapped.
+		/// </summary>
+		unsigned long long Location = 0;
+	};
+
+	/// <summary>
+	/// Parse the whole PE.
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="mode">Throw on malformed structures, or skip and report them</param>
+	PeModel(const std::shared_ptr<IRaw>& bFile, const ParseMode& mode = ParseMode::Strict);
+
+	PeModel(const PeModel&) = delete;
+	auto operator=(const PeModel&)->PeModel& = delete;
+	~PeModel() = default;
+
+	/// <summary>
+	/// Is the PE 64bit file?
+	/// </summary>
+	auto Is64Bit() const->bool;
+
+	/// <summary>
+	/// Machine of the file header, see MachineType.
+	/// </summary>
+	auto Machine() const->unsigned short;
+
+	/// <summary>
+	/// Characteristics of the file header, see FileCharacteristicsType.
+	/// </summary>
+	auto Characteristics() const->unsigned short;
+
+	/// <summary>
+	/// Subsystem of the optional header, see SubsystemType.
+	/// </summary>
+	auto Subsystem() const->unsigned short;
+
+	/// <summary>
+	/// RVA of the entry point.
+	/// </summary>
+	auto AddressOfEntryPoint() const->unsigned int;
+
+	/// <summary>
+	/// Preferred image base address.
+	/// </summary>
+	auto ImageBase() const->unsigned long long;
+
+	/// <summary>
+	/// All data directories, indexed by DataDirectoryType.
+	/// </summary>
+	auto DataDirectories() const->const std::pmr::vector<DataDirectory>&;
+
+	/// <summary>
+	/// Section headers in table order.
+	/// </summary>
+	auto Sections() const->const std::pmr::vector<Section>&;
+
+	/// <summary>
+	/// Import descriptors, up to the null descriptor.
+	/// </summary>
+	auto ImportModules() const->const std::pmr::vector<ImportModule>&;
+
+	/// <summary>
+	/// Imported functions of all import descriptors, grouped by descriptor.
+	/// </summary>
+	auto ImportedFunctions() const->const std::pmr::vector<ImportFunctionView>&;
+
+	/// <summary>
+	/// Exports ordered by ordinal, ordinal gaps are skipped.
+	/// </summary>
+	auto Exports() const->const std::pmr::vector<Export>&;
+
+	/// <summary>
+	/// Base relocations of all blocks, in file order.
+	/// </summary>
+	auto Relocations() const->const std::pmr::vector<Relocation>&;
+
+	/// <summary>
+	/// RUNTIME_FUNCTION entries of the exception directory, empty for anything but x64 files.
+	/// </summary>
+	auto RuntimeFunctions() const->const std::pmr::vector<RuntimeFunction>&;
+
+	/// <summary>
+	/// Virtual addresses of the TLS callbacks.
+	/// </summary>
+	auto TlsCallbacks() const->const std::pmr::vector<unsigned long long>&;
+
+	/// <summary>
+	/// Resource tree, empty when the PE has no resources.
+	/// </summary>
+	auto Resources() const->const std::optional<ResourceTree>&;
+
+	/// <summary>
+	/// Malformed structures which were skipped, always empty in ParseMode::Strict.
+	/// </summary>
+	auto Diagnostics() const->const std::pmr::vector<Diagnostic>&;
+
+private:
+	// variables
+	// The arena is declared first so it outlives every table allocated from it.
+	std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
+	ParseMode mode;
+	bool is64Bit = false;
+	unsigned short machine = 0;
+	unsigned short characteristics = 0;
+	unsigned short subsystem = 0;
+	unsigned int addressOfEntryPoint = 0;
+	unsigned long long imageBase = 0;
+	std::pmr::vector<DataDirectory> dataDirectories;
+	std::pmr::vector<Section> sections;
+	std::pmr::vector<ImportModule> importModules;
+	std::pmr::vector<ImportFunctionView> importedFunctions;
+	std::pmr::vector<Export> exports;
+	std::pmr::vector<Relocation> relocations;
+	std::pmr::vector<RuntimeFunction> runtimeFunctions;
+	std::pmr::vector<unsigned long long> tlsCallbacks;
+	std::optional<ResourceTree> resources;
+	std::pmr::vector<Diagnostic> diagnostics;
+
+	// functions
+	auto Fail(const ParseError& error, const std::optional<DataDirectoryType>& directory,
+		const unsigned long long& location)->bool;
+	auto Directory(const DataDirectoryType& type, long& offset)->bool;
+	auto Offset(const unsigned int& virtualAddress, const DataDirectoryType& type, long& offset)->bool;
+	auto Table(const long& offset, const size_t& count, const size_t& size, const DataDirectoryType& type)->bool;
+	auto Keep(const std::string_view& text)->std::string_view;
+	auto ViewAsciiString(const long& offset, const DataDirectoryType& type, std::string_view& text)->bool;
+	auto ParseHeaders()->bool;
+	auto ParseSections(const long& offset, const unsigned short& count)->bool;
+	auto ParseImports()->void;
+	auto ParseExports()->void;
+	auto ParseRelocations()->void;
+	auto ParseRuntimeFunctions()->void;
+	auto ParseTls()->void;
+	auto ParseResources()->void;
+};
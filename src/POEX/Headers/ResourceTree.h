@@ -0,0 +1,197 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "IRaw.h"
+#include <optional>
+#include <string_view>
+#include <memory_resource>
+
+/// <summary>
+/// One directory or data entry of the resource tree.
+/// </summary>
+struct ResourceNode
+{
+	/// <summary>
+	/// Index of the parent node, the root refers to itself.
+	/// </summary>
+	unsigned int Parent = 0;
+
+	/// <summary>
+	/// Index of the first child, the children of a node are stored one after another.
+	/// </summary>
+	unsigned int FirstChild = 0;
+
+	/// <summary>
+	/// Number of children, always zero for data entries.
+	/// </summary>
+	unsigned int ChildCount = 0;
+
+	/// <summary>
+	/// Numeric ID of the entry, zero for named entries.
+	/// </summary>
+	unsigned int Id = 0;
+
+	/// <summary>
+	/// Position of the name in the name pool of the tree, use ResourceTree::Name.
+	/// </summary>
+	unsigned int NameIndex = 0;
+
+	/// <summary>
+	/// Length of the name in characters, zero for ID entries.
+	/// </summary>
+	unsigned int NameLength = 0;
+
+	/// <summary>
+	/// Offset of the directory or the IMAGE_RESOURCE_DATA_ENTRY from the start of the resource directory.
+	/// </summary>
+	unsigned int Offset = 0;
+
+	/// <summary>
+	/// RVA of the resource data (IMAGE_RESOURCE_DATA_ENTRY OffsetToData).
+	/// </summary>
+	unsigned int DataRva = 0;
+
+	/// <summary>
+	/// Size of the resource data.
+	/// </summary>
+	unsigned int DataSize = 0;
+
+	/// <summary>
+	/// Code page of the resource data.
+	/// </summary>
+	unsigned int CodePage = 0;
+
+	/// <summary>
+	/// Level of the node: 0 root, 1 type, 2 name, 3 language.
+	/// </summary>
+	unsigned short Depth = 0;
+
+	/// <summary>
+	/// True when the entry is identified by a name instead of an ID.
+	/// </summary>
+	bool IsNamed = false;
+
+	/// <summary>
+	/// True for IMAGE_RESOURCE_DATA_ENTRY leaves, false for directories.
+	/// </summary>
+	bool IsData = false;
+};
+
+/// <summary>
+/// Type, name or language of a resource, identified either by a numeric ID or by a name.
+/// </summary>
+struct ResourceId
+{
+	ResourceId(const unsigned int& id = 0);
+	ResourceId(const std::wstring_view& name);
+	ResourceId(const wchar_t* name);
+
+	/// <summary>
+	/// Numeric ID, zero for names.
+	/// </summary>
+	unsigned int Id = 0;
+
+	/// <summary>
+	/// Name, empty for IDs.
+	/// </summary>
+	std::wstring_view Name;
+
+	/// <summary>
+	/// True when the resource is identified by Name.
+	/// </summary>
+	bool IsNamed = false;
+};
+
+/// <summary>
+/// Data entry of the resource tree with the type, name and language it is filed under.
+/// </summary>
+struct ResourceEntry
+{
+	ResourceId Type;
+	ResourceId Name;
+	unsigned int Language = 0;
+
+	/// <summary>
+	/// Data node of the tree, holds the IMAGE_RESOURCE_DATA_ENTRY fields.
+	/// </summary>
+	const ResourceNode* Data = nullptr;
+};
+
+/// <summary>
+/// Resource directory decoded iteratively into one flat node array with parent/child indices.
+/// Node 0 is the root directory. Names are kept in one pool instead of a string per node.
+/// Hostile data can't make it grow past three levels, one node per entry-sized slice of the directory
+/// and one name character per two bytes.
+/// </summary>
+class ResourceTree
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="offset">File offset of the resource directory</param>
+	/// <param name="length">Size of the resource directory</param>
+	/// <param name="memoryResource">Memory resource which holds the nodes and names</param>
+	ResourceTree(const std::shared_ptr<IRaw>& bFile, const long& offset, const unsigned int& length,
+		std::pmr::memory_resource* memoryResource = std::pmr::get_default_resource());
+
+	/// <summary>
+	/// All nodes in breadth-first order, the root first.
+	/// </summary>
+	/// <returns>List of nodes</returns>
+	auto Nodes() const->const std::pmr::vector<ResourceNode>&;
+
+	/// <summary>
+	/// Name of a named entry.
+	/// </summary>
+	/// <param name="node">Node of this tree</param>
+	/// <returns>View over the name, empty for ID entries</returns>
+	auto Name(const ResourceNode& node) const->std::wstring_view;
+
+	/// <summary>
+	/// File offset of the resource directory.
+	/// </summary>
+	/// <returns>Offset</returns>
+	auto Offset() const->long;
+
+	/// <summary>
+	/// Find a direct child of a directory node by binary search.
+	/// Entries are expected in the order the format requires: names first, then IDs, both ascending.
+	/// Names are compared ignoring case, like the loader does.
+	/// </summary>
+	/// <param name="directory">Directory node of this tree</param>
+	/// <param name="id">Name or ID of the child</param>
+	/// <returns>Child node, nullptr when it doesn't exist</returns>
+	auto FindChild(const ResourceNode& directory, const ResourceId& id) const->const ResourceNode*;
+
+	/// <summary>
+	/// Find the data entry of a resource, e.g. Find(24, 1) for the manifest of an executable.
+	/// </summary>
+	/// <param name="type">Type of the resource</param>
+	/// <param name="name">Name or ID of the resource</param>
+	/// <param name="language">Language ID, the first language of the resource when empty</param>
+	/// <returns>Data node with the RVA, size and code page, nullptr when it doesn't exist</returns>
+	auto Find(const ResourceId& type, const ResourceId& name,
+		const std::optional<unsigned int>& language = std::nullopt) const->const ResourceNode*;
+
+	/// <summary>
+	/// All data entries of the tree, in breadth-first order.
+	/// </summary>
+	/// <returns>List of data entries</returns>
+	auto DataEntries() const->std::vector<ResourceEntry>;
+
+private:
+	// variables
+	std::pmr::vector<ResourceNode> nodes;
+	std::pmr::wstring names;
+	long offset;
+
+	// functions
+	auto Decode(const std::shared_ptr<IRaw>& bFile, const unsigned int& length)->void;
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "ImageExceptionDirectory.h"
+#include <optional>
+
+/// <summary>
+/// One decoded UNWIND_CODE operation, together with the slots it uses.
+/// </summary>
+struct UnwindCode
+{
+	/// <summary>
+	/// Offset from the start of the prolog of the end of the instruction.
+	/// </summary>
+	unsigned char CodeOffset = 0;
+
+	/// <summary>
+	/// Unwind operation.
+	/// </summary>
+	UnwindOperation Operation = UnwindOperation::PushNonVolatile;
+
+	/// <summary>
+	/// Operation info, a register number for most operations.
+	/// </summary>
+	unsigned char OperationInfo = 0;
+
+	/// <summary>
+	/// Allocation size or save offset in bytes, zero for operations which have none.
+	/// </summary>
+	unsigned int Operand = 0;
+};
+
+/// <summary>
+/// Decoded x64 UNWIND_INFO.
+/// </summary>
+struct UnwindInfo
+{
+	/// <summary>
+	/// RVA of the UNWIND_INFO.
+	/// </summary>
+	unsigned int Address = 0;
+
+	/// <summary>
+	/// Version of the structure, 1 or 2.
+	/// </summary>
+	unsigned char Version = 0;
+
+	/// <summary>
+	/// UNW_FLAG_EHANDLER (1), UNW_FLAG_UHANDLER (2) or UNW_FLAG_CHAININFO (4).
+	/// </summary>
+	unsigned char Flags = 0;
+
+	/// <summary>
+	/// Length of the prolog in bytes.
+	/// </summary>
+	unsigned char SizeOfProlog = 0;
+
+	/// <summary>
+	/// Nonvolatile register used as frame pointer, zero without a frame pointer.
+	/// </summary>
+	unsigned char FrameRegister = 0;
+
+	/// <summary>
+	/// Scaled offset of the frame pointer, the offset in bytes is FrameOffset * 16.
+	/// </summary>
+	unsigned char FrameOffset = 0;
+
+	/// <summary>
+	/// Unwind operations, in the order they are stored (reverse order of the prolog).
+	/// </summary>
+	std::vector<UnwindCode> Codes;
+
+	/// <summary>
+	/// RVA of the language specific handler, zero without UNW_FLAG_EHANDLER or UNW_FLAG_UHANDLER.
+	/// </summary>
+	unsigned int ExceptionHandler = 0;
+
+	/// <summary>
+	/// Primary function which continues the unwinding, only with UNW_FLAG_CHAININFO.
+	/// </summary>
+	std::optional<RuntimeFunction> Chained;
+};
+
+/// <summary>
+/// RUNTIME_FUNCTION entries of an x64 image in one array sorted by begin address.
+/// Functions are found by binary search, their UNWIND_INFO is only decoded on request.
+/// It is immutable once built. Sharing it between threads is safe when the PE data is only read,
+/// e.g. Buffered, Mapped or LazyFile data without concurrent writes.
+/// </summary>
+class RuntimeFunctionIndex
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="bFile">PE data</param>
+	/// <param name="sectionIndex">Section index of the PE</param>
+	/// <param name="functions">RUNTIME_FUNCTION entries, they are sorted when they aren't already</param>
+	RuntimeFunctionIndex(const std::shared_ptr<IRaw>& bFile, const std::shared_ptr<const SectionIndex>& sectionIndex,
+		std::vector<RuntimeFunction> functions);
+
+	/// <summary>
+	/// Find the function which contains a relative virtual address.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>The function, nullptr when no function contains the address</returns>
+	auto FindFunction(const unsigned int& virtualAddress) const->const RuntimeFunction*;
+
+	/// <summary>
+	/// Decode the UNWIND_INFO of a function, indirect entries are followed to their function.
+	/// </summary>
+	/// <param name="function">Function of this index</param>
+	/// <returns>Unwind information, nothing when it isn't in the file</returns>
+	auto Unwind(const RuntimeFunction& function) const->std::optional<UnwindInfo>;
+
+	/// <summary>
+	/// Decode the UNWIND_INFO of a function and every chained UNWIND_INFO after it.
+	/// </summary>
+	/// <param name="function">Function of this index</param>
+	/// <returns>Unwind information in unwinding order, the function itself first</returns>
+	auto UnwindChain(const RuntimeFunction& function) const->std::vector<UnwindInfo>;
+
+	/// <summary>
+	/// All functions sorted by begin address.
+	/// </summary>
+	/// <returns>List of functions</returns>
+	auto Functions() const->const std::vector<RuntimeFunction>&;
+
+private:
+	// variables
+	std::shared_ptr<IRaw> bFile;
+	std::shared_ptr<const SectionIndex> sectionIndex;
+	std::vector<RuntimeFunction> functions;
+
+	// functions
+	auto Decode(const unsigned int& address) const->std::optional<UnwindInfo>;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "SectionTable.h"
+#include <atomic>
+
+/// <summary>
+/// Sorted interval index over a SectionTable for RVA/VA to file offset translation.
+/// Lookups are a binary search with a fast path for
+/// the section which matched last. Safe to share between threads.
+/// </summary>
+class SectionIndex
+{
+public:
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="sectionTable">Section table to index</param>
+	explicit SectionIndex(const std::shared_ptr<const SectionTable>& sectionTable);
+
+	/// <summary>
+	/// Constructor
+	/// </summary>
+	/// <param name="sectionHeaders">Section headers in table order</param>
+	explicit SectionIndex(const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders);
+
+	SectionIndex(const SectionIndex&) = delete;
+	auto operator=(const SectionIndex&)->SectionIndex& = delete;
+	~SectionIndex() = default;
+
+	/// <summary>
+	/// Find the section which contains a relative virtual address.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>Index of the section in the table, -1 if there is none</returns>
+	auto Find(const unsigned int& virtualAddress) const->long;
+
+	/// <summary>
+	/// Convert relative virtual address to file offset without throwing.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>File offset, -1 if the address isn't in any section</returns>
+	auto FindOffset(const unsigned int& virtualAddress) const->long;
+
+	/// <summary>
+	/// Convert relative virtual address to file offset.
+	/// </summary>
+	/// <param name="virtualAddress">Relative virtual address</param>
+	/// <returns>File offset</returns>
+	auto RvaToOffset(const unsigned int& virtualAddress) const->unsigned int;
+
+	/// <summary>
+	/// Convert virtual address to file offset.
+	/// </summary>
+	/// <param name="virtualAddress">Virtual address</param>
+	/// <returns>File offset</returns>
+	auto VaToOffset(const unsigned long long& virtualAddress) const->unsigned long;
+
+	/// <summary>
+	/// Image base which virtual addresses are relative to.
+	/// </summary>
+	/// <returns>Image base address</returns>
+	auto ImageBaseAddress() const->unsigned long long;
+
+	/// <summary>
+	/// Indexed section table.
+	/// </summary>
+	/// <returns>Section table</returns>
+	auto Table() const->const SectionTable&;
+
+private:
+	SectionIndex() = default;
+
+	// variables
+	std::shared_ptr<const SectionTable> sectionTable;
+	std::vector<unsigned int> sorted;
+	bool overlapping = false;
+	mutable std::atomic<unsigned int> lastHit{ 0 };
+
+	// functions
+	auto Contains(const unsigned int& index, const unsigned int& virtualAddress, const bool& inclusive = false) const->bool;
+};
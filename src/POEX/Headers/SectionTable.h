@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+#include "ImageSectionHeader.h"
+
+/// <summary>
+/// Flat copy of the section table, one contiguous array per field.
+/// The whole table is read at once, so walking sections doesn't touch the file or the heap.
+/// </summary>
+class SectionTable
+{
+public:
+	/// <summary>
+	/// Constructor, read the section table from the file
+	/// </summary>
+	/// <param name="bFile">A PE file</param>
+	/// <param name="offset">Location of the first section header</param>
+	/// <param name="numberOfSections">Number of section headers</param>
+	/// <param name="imageBaseAddress">Image base which virtual addresses are relative to</param>
+	SectionTable(const std::shared_ptr<IRaw>& bFile, const long& offset, const unsigned short& numberOfSections,
+		const unsigned long long& imageBaseAddress);
+
+	/// <summary>
+	/// Constructor, copy the values of section header objects
+	/// </summary>
+	/// <param name="sectionHeaders">Section headers in table order</param>
+	explicit SectionTable(const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders);
+
+	~SectionTable() = default;
+
+	/// <summary>
+	/// Number of sections.
+	/// </summary>
+	/// <returns>Number of sections</returns>
+	auto Count() const->size_t;
+
+	/// <summary>
+	/// Image base which virtual addresses are relative to.
+	/// </summary>
+	/// <returns>Image base address</returns>
+	auto ImageBaseAddress() const->unsigned long long;
+
+	/// <summary>
+	/// Location of the first section header in the file.
+	/// </summary>
+	/// <returns>File offset, 0 if the table was not read from a file</returns>
+	auto Offset() const->long;
+
+	/// <summary>
+	/// Relative virtual address of every section, in table order.
+	/// </summary>
+	/// <returns>Array of addresses</returns>
+	auto VirtualAddresses() const->const std::vector<unsigned int>&;
+
+	/// <summary>
+	/// Size in memory of every section, in table order.
+	/// </summary>
+	/// <returns>Array of sizes</returns>
+	auto VirtualSizes() const->const std::vector<unsigned int>&;
+
+	/// <summary>
+	/// File offset of the raw data of every section, in table order.
+	/// </summary>
+	/// <returns>Array of offsets</returns>
+	auto PointersToRawData() const->const std::vector<unsigned int>&;
+
+	/// <summary>
+	/// Size in the file of every section, in table order.
+	/// </summary>
+	/// <returns>Array of sizes</returns>
+	auto SizesOfRawData() const->const std::vector<unsigned int>&;
+
+	/// <summary>
+	/// Characteristics of every section, in table order.
+	/// </summary>
+	/// <returns>Array of characteristics</returns>
+	auto Characteristics() const->const std::vector<unsigned int>&;
+
+private:
+	SectionTable() = default;
+
+	// variables
+	unsigned long long imageBaseAddress = 0;
+	long offset = 0;
+	std::vector<unsigned int> virtualAddresses;
+	std::vector<unsigned int> virtualSizes;
+	std::vector<unsigned int> pointersToRawData;
+	std::vector<unsigned int> sizesOfRawData;
+	std::vector<unsigned int> characteristics;
+
+	// functions
+	auto Reserve(const size_t& count)->void;
+};
@@ -7,6 +7,8 @@
 */
 
 #include "ImageSectionHeader.h"
+#include <filesystem>
+#include <optional>
 
 class Utils
 {
@@ -15,6 +17,12 @@ public:
 		const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders) -> unsigned long;
 	auto static RvaToOffset(const unsigned int& virtualAddress, 
 		const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders)->unsigned int;
+	auto static CopyToFile(const std::shared_ptr<IRaw>& bFile, const long& offset, const size_t& length,
+		const std::filesystem::path& filepath)->void;
+	auto static WriteDirtyRanges(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath)->void;
+	auto static ReplaceFile(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath,
+		const bool& cloneUnchanged = true)->void;
+	auto static IsSourceFile(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath)->std::optional<bool>;
 
 private:
 	Utils() = default;
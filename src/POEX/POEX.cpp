@@ -1,8 +1,19 @@
 #include "POEX.h"
 #include "Headers/Utils.h"
 #include <sstream>
-#include <fstream>
 #include <memory>
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
 
 /**
 * Portable Executable (POEX) Project
@@ -10,6 +21,74 @@
 * Url: https://github.com/AFP33/POEX
 */
 
+namespace
+{
+    /// <summary>
+    /// File name part of a resource ID, characters which aren't safe in a file name are replaced.
+    /// </summary>
+    auto ResourceFileName(const ResourceId& id) -> std::wstring
+    {
+        if (!id.IsNamed)
+            return std::to_wstring(id.Id);
+
+        std::wstring name(id.Name);
+        for (auto& c : name)
+            if (!((c >= L'0' && c <= L'9') || (c >= L'A' && c <= L'Z') || (c >= L'a' && c <= L'z') || c == L'-'))
+                c = L'_';
+        return name;
+    }
+
+    /// <summary>
+    /// Number of bytes patched by a base relocation type, zero when the type isn't supported.
+    /// </summary>
+    auto RelocationSize(const unsigned short& type) -> size_t
+    {
+        switch (type)
+        {
+        case IMAGE_REL_BASED_HIGH:
+        case IMAGE_REL_BASED_LOW:
+            return sizeof(unsigned short);
+        case IMAGE_REL_BASED_HIGHLOW:
+            return sizeof(unsigned int);
+        case IMAGE_REL_BASED_DIR64:
+            return sizeof(unsigned long long);
+        default:
+            return 0;
+        }
+    }
+
+    /// <summary>
+    /// Add the image base difference to a relocated location, the same way the loader does.
+    /// </summary>
+    template <typename T>
+    auto Relocate(byte* location, const T& delta) -> void
+    {
+        T value;
+        std::memcpy(&value, location, sizeof(T));
+        value = static_cast<T>(value + delta);
+        std::memcpy(location, &value, sizeof(T));
+    }
+
+    auto ApplyRelocation(byte* location, const unsigned short& type, const unsigned long long& delta) -> void
+    {
+        switch (type)
+        {
+        case IMAGE_REL_BASED_HIGH:
+            Relocate<unsigned short>(location, static_cast<unsigned short>(delta >> 16));
+            break;
+        case IMAGE_REL_BASED_LOW:
+            Relocate<unsigned short>(location, static_cast<unsigned short>(delta));
+            break;
+        case IMAGE_REL_BASED_HIGHLOW:
+            Relocate<unsigned int>(location, static_cast<unsigned int>(delta));
+            break;
+        case IMAGE_REL_BASED_DIR64:
+            Relocate<unsigned long long>(location, delta);
+            break;
+        }
+    }
+}
+
 FileCharacteristicsType operator&(const FileCharacteristicsType& first, const FileCharacteristicsType& second)
 {
     return static_cast<FileCharacteristicsType>(
@@ -24,19 +103,56 @@ POEX::PE::PE(const std::vector<byte>& raw)
     this->filepath = L"";
 }
 
-POEX::PE::PE(CString filepath)
+POEX::PE::PE(std::vector<byte>&& raw)
+{
+    this->bFile = std::make_shared<BufferFile>(std::move(raw));
+    this->filepath = L"";
+}
+
+POEX::PE::PE(const byte* raw, const size_t& length)
+{
+    this->bFile = std::make_shared<BufferFile>(raw, length);
+    this->filepath = L"";
+}
+
+POEX::PE::PE(const std::shared_ptr<IRaw>& raw)
+{
+    if (raw == nullptr || raw->Length() == 0)
+        THROW_EXCEPTION("[ERROR] data cann't be empty.");
+    this->bFile = raw;
+    this->filepath = L"";
+}
+
+POEX::PE::PE(const std::filesystem::path& filepath, const FileAccessType& accessType)
 {
     try
     {
+        if (accessType == FileAccessType::Mapped)
+        {
+            this->filepath = filepath;
+            // The mapping is never written, edits are kept as patches on top of it.
+            auto mapping = std::make_shared<MappedFile>(filepath);
+            this->bFile = std::make_shared<PatchedFile>(mapping);
+            return;
+        }
+
+        if (accessType == FileAccessType::Lazy)
+        {
+            this->filepath = filepath;
+            auto file = std::make_shared<LazyFile>(filepath);
+            this->bFile = std::make_shared<PatchedFile>(file);
+            return;
+        }
+
         auto data = loadFile(filepath);
         if (data.size() <= 0)
             THROW_EXCEPTION("[ERROR] data cann't be empty.");
         this->filepath = filepath;
-        this->bFile = std::make_shared<BufferFile>(data);
+        this->bFile = std::make_shared<BufferFile>(std::move(data));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -46,9 +162,9 @@ auto POEX::PE::GetImageDosHeader() -> ImageDosHeader
     {
         return ImageDosHeader(this->bFile);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -56,11 +172,11 @@ auto POEX::PE::GetImageNtHeader() -> ImageNtHeader
 {
     try
     {
-        return ImageNtHeader(this->bFile, GetImageDosHeader().E_lfanew());
+        return ImageNtHeader(this->bFile, Headers().ntHeaderOffset);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -68,22 +184,46 @@ auto POEX::PE::GetImageSectionHeader() -> std::vector<std::shared_ptr<ImageSecti
 {
     try
     {
-        auto fHeader = GetImageNtHeader().FileHeader();
-        auto oHeader = GetImageNtHeader().OptionalHeader();
-
-        auto offset = GetImageDosHeader().E_lfanew() + ((unsigned int)fHeader.SizeOfOptionalHeader() + PE_SIGNATURE_UNTIL_MAGIC);
-        auto numberOfSection = fHeader.NumberOfSection();
-        auto imageBaseAddress = oHeader.ImageBase();
+        // The header objects are only needed by this getter, create them on first use.
+        auto& snapshot = Headers();
+        if (snapshot.sectionHeaders.size() != snapshot.sectionTable->Count())
+        {
+            auto& sectionHeaders = this->headers.sectionHeaders;
+            sectionHeaders.reserve(snapshot.sectionTable->Count());
+            for (size_t i = 0; i < snapshot.sectionTable->Count(); i++)
+                sectionHeaders.push_back(std::make_shared<ImageSectionHeader>(this->bFile,
+                    snapshot.sectionTable->Offset() + static_cast<long>(i) * SECTION_HEADER_SIZE,
+                    static_cast<unsigned long>(snapshot.sectionTable->ImageBaseAddress())));
+        }
+        return snapshot.sectionHeaders;
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
 
-        std::vector<std::shared_ptr<ImageSectionHeader>> sectionHeaders;
-        for (size_t i = 0; i < numberOfSection; i++)
-            sectionHeaders.push_back(std::make_shared<ImageSectionHeader>(this->bFile, offset + static_cast<const long>(i) * SECTION_HEADER_SIZE, imageBaseAddress));
+auto POEX::PE::GetSectionTable() -> std::shared_ptr<const SectionTable>
+{
+    try
+    {
+        return Headers().sectionTable;
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
 
-        return sectionHeaders;
+auto POEX::PE::GetSectionIndex() -> std::shared_ptr<const SectionIndex>
+{
+    try
+    {
+        return Headers().sectionIndex;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -91,20 +231,18 @@ auto POEX::PE::GetImageExportDirectory() -> std::unique_ptr<ImageExportDirectory
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& exportDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::Export)];
+        auto exportDataDirectory = GetDataDirectory(DataDirectoryType::Export);
         if (!IsValidDataDirectory(exportDataDirectory))
             return NULL;
-        auto offset = Utils::RvaToOffset(exportDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(exportDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
         return std::unique_ptr<ImageExportDirectory>(
-            new ImageExportDirectory(this->bFile, offset, this->GetImageSectionHeader(), std::move(exportDataDirectory)));
+            new ImageExportDirectory(this->bFile, offset, Headers().sectionIndex, std::move(exportDataDirectory)));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -113,40 +251,35 @@ auto POEX::PE::GetImageImportDirectory() -> std::vector<std::unique_ptr<ImageImp
     try
     {
         std::vector<std::unique_ptr<ImageImportDirectory>> importTables;
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& importDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::Import)];
-        auto& iatDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::IAT)];
-        if (!IsValidDataDirectory(importDataDirectory) || !IsValidDataDirectory(iatDataDirectory))
-            return importTables;
+        for (const auto& imageImportDirectory : GetImportDescriptors())
+            importTables.push_back(std::unique_ptr<ImageImportDirectory>(new ImageImportDirectory(imageImportDirectory)));
 
-        auto offset = Utils::RvaToOffset(importDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
-        if (WRONG_LONG(offset))
-            return importTables;
-
-        unsigned int iterator = 0;
+        return importTables;
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
 
-        while (true)
-        {
-            auto imageImportDirectory = std::unique_ptr<ImageImportDirectory>(new ImageImportDirectory(this->bFile,
-                offset + IMPORT_TABLE_SIZE * iterator, this->GetImageSectionHeader(), iatDataDirectory->VirtualAddress(), this->Is64Bit()));
-
-            // Found the last ImageImportDescriptor which is completely null (except TimeDateStamp).
-            if (imageImportDirectory->ImportLookupTable() == 0 &&
-                imageImportDirectory->ForwarderChain() == 0 &&
-                imageImportDirectory->Name() == 0 &&
-                imageImportDirectory->ImportAddressTable() == 0)
-                break;
+auto POEX::PE::GetImportDescriptors() -> ImportDescriptorRange
+{
+    try
+    {
+        auto importDataDirectory = GetDataDirectory(DataDirectoryType::Import);
+        auto iatDataDirectory = GetDataDirectory(DataDirectoryType::IAT);
+        if (!IsValidDataDirectory(importDataDirectory) || !IsValidDataDirectory(iatDataDirectory))
+            return ImportDescriptorRange();
 
-            importTables.push_back(std::move(imageImportDirectory));
-            iterator++;
-        }
+        auto offset = Headers().sectionIndex->RvaToOffset(importDataDirectory->VirtualAddress());
+        if (WRONG_LONG(offset))
+            return ImportDescriptorRange();
 
-        return importTables;
+        return ImportDescriptorRange(this->bFile, Headers().sectionIndex, offset, iatDataDirectory->VirtualAddress(), this->Is64Bit());
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -154,20 +287,86 @@ auto POEX::PE::GetImageResourceDirectory() -> std::unique_ptr<ImageResourceDirec
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& resourceDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::Resource)];
+        auto resourceDataDirectory = GetDataDirectory(DataDirectoryType::Resource);
         if (!IsValidDataDirectory(resourceDataDirectory))
             return NULL;
-        auto offset = Utils::RvaToOffset(resourceDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(resourceDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
         
         return std::make_unique<ImageResourceDirectory>(this->bFile, offset, offset, resourceDataDirectory->Size());
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
+
+auto POEX::PE::GetResourceData(const ResourceNode& data, std::vector<byte>& storage) -> ByteView
+{
+    try
+    {
+        if (!data.IsData)
+            return ByteView();
+
+        auto offset = Headers().sectionIndex->FindOffset(data.DataRva);
+        if (offset < 0 || !this->bFile->InRange(offset, data.DataSize))
+            return ByteView();
+
+        // Never make the whole file contiguous for one resource, read just its bytes instead.
+        auto block = this->bFile->ContiguousData();
+        if (!block.empty())
+            return ByteView{ block.Pointer + offset, data.DataSize };
+
+        storage.resize(data.DataSize);
+        this->bFile->ReadBytes(offset, storage.data(), storage.size());
+        return ByteView{ storage.data(), storage.size() };
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
+
+auto POEX::PE::ExtractResources(const std::filesystem::path& directory) -> size_t
+{
+    try
+    {
+        auto resources = GetImageResourceDirectory();
+        if (resources == nullptr)
+            return 0;
+
+        std::filesystem::create_directories(directory);
+        auto tree = resources->Tree();
+        size_t count = 0;
+        std::unordered_set<std::wstring> used;
+        for (const auto& entry : tree.DataEntries())
+        {
+            auto offset = Headers().sectionIndex->FindOffset(entry.Data->DataRva);
+            if (offset < 0 || !this->bFile->InRange(offset, entry.Data->DataSize))
+                continue;
+
+            // Different names can sanitize to the same file name (also when case is ignored), number the later ones.
+            auto stem = ResourceFileName(entry.Type) + L"_" + ResourceFileName(entry.Name) + L"_" +
+                std::to_wstring(entry.Language);
+            auto name = stem;
+            for (size_t suffix = 2;; suffix++)
+            {
+                auto key = name;
+                std::transform(key.begin(), key.end(), key.begin(),
+                    [](const wchar_t& c) { return c >= L'A' && c <= L'Z' ? static_cast<wchar_t>(c - L'A' + L'a') : c; });
+                if (used.insert(key).second)
+                    break;
+                name = stem + L"_" + std::to_wstring(suffix);
+            }
+            Utils::CopyToFile(this->bFile, offset, entry.Data->DataSize, directory / (name + L".bin"));
+            count++;
+        }
+        return count;
+    }
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -175,22 +374,42 @@ auto POEX::PE::GetImageExceptionDirectory() -> std::unique_ptr<ImageExceptionDir
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& exceptionDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::Exception)];
+        auto exceptionDataDirectory = GetDataDirectory(DataDirectoryType::Exception);
         if (!IsValidDataDirectory(exceptionDataDirectory))
             return NULL;
-        auto offset = Utils::RvaToOffset(exceptionDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(exceptionDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
         return std::unique_ptr<ImageExceptionDirectory>(
-            new ImageExceptionDirectory(this->bFile, offset, this->GetImageSectionHeader(), this->Is32Bit(), 
+            new ImageExceptionDirectory(this->bFile, offset, Headers().sectionIndex, this->Is32Bit(), 
                 exceptionDataDirectory->Size()));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
+    }
+}
+
+auto POEX::PE::GetRuntimeFunctionIndex() -> std::unique_ptr<RuntimeFunctionIndex>
+{
+    try
+    {
+        // Other machines use other RUNTIME_FUNCTION and unwind formats.
+        auto machine = this->bFile->Read<unsigned short>(Headers().ntHeaderOffset + 0x0004);
+        if (machine != (unsigned short)MachineType::Amd64)
+            return NULL;
+
+        auto exceptionDirectory = GetImageExceptionDirectory();
+        if (exceptionDirectory == nullptr)
+            return NULL;
+
+        return std::make_unique<RuntimeFunctionIndex>(this->bFile, Headers().sectionIndex,
+            exceptionDirectory->GetRuntimeFunctions());
+    }
+    catch (const std::exception&)
+    {
+        throw;
     }
 }
 
@@ -198,22 +417,20 @@ auto POEX::PE::GetImageTlsDirectory() -> std::unique_ptr<ImageTlsDirectory>
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& tlsDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::TLS)];
+        auto tlsDataDirectory = GetDataDirectory(DataDirectoryType::TLS);
         if (!IsValidDataDirectory(tlsDataDirectory))
             return NULL;
 
-        auto offset = Utils::RvaToOffset(tlsDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(tlsDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
         return std::unique_ptr<ImageTlsDirectory>(new ImageTlsDirectory(this->bFile, offset, 
-            this->GetImageSectionHeader(), this->Is64Bit()));
+            Headers().sectionIndex, this->Is64Bit()));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -221,13 +438,11 @@ auto POEX::PE::GetImageLoadConfigDirectory() -> std::unique_ptr<ImageLoadConfigD
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& configDataDirectory = dataDirectories[static_cast<int>(DataDirectoryType::LoadConfig)];
+        auto configDataDirectory = GetDataDirectory(DataDirectoryType::LoadConfig);
         if (!IsValidDataDirectory(configDataDirectory))
             return NULL;
 
-        auto offset = Utils::RvaToOffset(configDataDirectory->VirtualAddress(), this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(configDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
@@ -235,9 +450,9 @@ auto POEX::PE::GetImageLoadConfigDirectory() -> std::unique_ptr<ImageLoadConfigD
             offset,
             this->Is64Bit()));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -246,15 +461,11 @@ auto POEX::PE::GetImageBaseRelocation() -> std::vector<std::unique_ptr<ImageBase
     try
     {
         std::vector<std::unique_ptr<ImageBaseRelocation>> imageBaseRelocations;
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& relocationDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::BaseReloc)];
+        auto relocationDataDirectory = GetDataDirectory(DataDirectoryType::BaseReloc);
         if (!IsValidDataDirectory(relocationDataDirectory))
             return imageBaseRelocations;
             
-        auto offset = Utils::RvaToOffset(relocationDataDirectory->VirtualAddress(), 
-            this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(relocationDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return imageBaseRelocations;
 
@@ -271,9 +482,114 @@ auto POEX::PE::GetImageBaseRelocation() -> std::vector<std::unique_ptr<ImageBase
 
         return imageBaseRelocations;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
+
+auto POEX::PE::GetRelocations() -> std::vector<RelocationEntry>
+{
+    try
     {
-        throw ex;
+        std::vector<RelocationEntry> relocations;
+        auto relocationDataDirectory = GetDataDirectory(DataDirectoryType::BaseReloc);
+        if (!IsValidDataDirectory(relocationDataDirectory))
+            return relocations;
+
+        auto offset = Headers().sectionIndex->RvaToOffset(relocationDataDirectory->VirtualAddress());
+        if (WRONG_LONG(offset))
+            return relocations;
+
+        // Every entry takes 2 bytes, size the list once for the whole directory (never past the data).
+        auto available = static_cast<size_t>(offset) < this->bFile->Length() ? this->bFile->Length() - offset : 0;
+        relocations.reserve(std::min<size_t>(relocationDataDirectory->Size(), available) / 2);
+
+        // Blocks are decoded in place, without an object per block or per entry.
+        auto currentBlock = offset;
+        while (currentBlock < offset + relocationDataDirectory->Size() - 8)
+        {
+            ImageBaseRelocation block(this->bFile, currentBlock, relocationDataDirectory->Size());
+            block.Relocations(relocations);
+            currentBlock += block.SizeOfBlock();
+        }
+        return relocations;
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
+
+auto POEX::PE::Rebase(const unsigned long long& newImageBase) -> void
+{
+    try
+    {
+        auto relocations = GetRelocations();
+        for (const auto& relocation : relocations)
+            if (RelocationSize(relocation.Type) == 0)
+                THROW_RUNTIME("[ERROR] Relocation type isn't supported.");
+
+        // Relocated locations can be in the headers, keep the index of the current layout.
+        auto sectionIndex = Headers().sectionIndex;
+        auto imageBaseOffset = Headers().ntHeaderOffset + 0x0018 + (Is64Bit() ? 0x0018 : 0x001C);
+        auto imageBaseSize = Is64Bit() ? sizeof(unsigned long long) : sizeof(unsigned int);
+        auto imageBase = Is64Bit() ? this->bFile->Read<unsigned long long>(imageBaseOffset) :
+            this->bFile->Read<unsigned int>(imageBaseOffset);
+        auto delta = newImageBase - imageBase;
+
+        std::vector<byte> page;
+        size_t first = 0;
+        while (first < relocations.size())
+        {
+            // A block covers one page: its span is read once, patched in memory and written once.
+            auto pageAddress = relocations[first].VirtualAddress >> 12;
+            auto low = relocations[first].VirtualAddress;
+            auto high = low;
+            auto last = first;
+            for (; last < relocations.size() && (relocations[last].VirtualAddress >> 12) == pageAddress; last++)
+            {
+                low = std::min(low, relocations[last].VirtualAddress);
+                high = std::max(high, relocations[last].VirtualAddress +
+                    static_cast<unsigned int>(RelocationSize(relocations[last].Type)));
+            }
+
+            auto start = sectionIndex->FindOffset(low);
+            auto end = sectionIndex->FindOffset(high - 1);
+            if (start >= 0 && end - start == static_cast<long>(high - 1 - low) && this->bFile->InRange(start, high - low))
+            {
+                page.resize(high - low);
+                this->bFile->ReadBytes(start, page.data(), page.size());
+                for (auto i = first; i < last; i++)
+                    ApplyRelocation(page.data() + (relocations[i].VirtualAddress - low), relocations[i].Type, delta);
+                this->bFile->WriteBytes(start, page);
+            }
+            else
+            {
+                // The page isn't one range of the file, patch entry by entry.
+                for (auto i = first; i < last; i++)
+                {
+                    auto size = RelocationSize(relocations[i].Type);
+                    auto location = sectionIndex->FindOffset(relocations[i].VirtualAddress);
+                    auto locationEnd = sectionIndex->FindOffset(relocations[i].VirtualAddress + static_cast<unsigned int>(size) - 1);
+                    if (location < 0 || locationEnd - location != static_cast<long>(size - 1) || !this->bFile->InRange(location, size))
+                        continue;
+                    page.resize(size);
+                    this->bFile->ReadBytes(location, page.data(), page.size());
+                    ApplyRelocation(page.data(), relocations[i].Type, delta);
+                    this->bFile->WriteBytes(location, page);
+                }
+            }
+            first = last;
+        }
+
+        std::vector<byte> value(imageBaseSize);
+        std::memcpy(value.data(), &newImageBase, value.size());
+        this->bFile->WriteBytes(imageBaseOffset, value);
+    }
+    catch (const std::exception&)
+    {
+        throw;
     }
 }
 
@@ -281,23 +597,19 @@ auto POEX::PE::GetImageDelayImportDescriptor() -> std::unique_ptr<ImageDelayImpo
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& delayImportDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::DelayImport)];
+        auto delayImportDataDirectory = GetDataDirectory(DataDirectoryType::DelayImport);
         if (!IsValidDataDirectory(delayImportDataDirectory))
             return NULL;
 
-        auto offset = Utils::RvaToOffset(delayImportDataDirectory->VirtualAddress(),
-            this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(delayImportDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
         return std::make_unique<ImageDelayImportDescriptor>(this->bFile, offset);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -307,15 +619,11 @@ auto POEX::PE::GetImageDebugDirectory() -> std::vector<std::unique_ptr<ImageDebu
     {
         std::vector<std::unique_ptr<ImageDebugDirectory>> debugDirectories;
         auto debugEntrySize = 28;
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& debugDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::Debug)];
+        auto debugDataDirectory = GetDataDirectory(DataDirectoryType::Debug);
         if (!IsValidDataDirectory(debugDataDirectory))
             return debugDirectories;
 
-        auto offset = Utils::RvaToOffset(debugDataDirectory->VirtualAddress(),
-            this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(debugDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return debugDirectories;
 
@@ -324,9 +632,9 @@ auto POEX::PE::GetImageDebugDirectory() -> std::vector<std::unique_ptr<ImageDebu
             debugDirectories.push_back(std::make_unique<ImageDebugDirectory>(this->bFile, offset));
         return debugDirectories;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -334,23 +642,19 @@ auto POEX::PE::GetImageBoundImportDirectory() -> std::unique_ptr<ImageBoundImpor
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& boundImportDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::BoundImport)];
+        auto boundImportDataDirectory = GetDataDirectory(DataDirectoryType::BoundImport);
         if (!IsValidDataDirectory(boundImportDataDirectory))
             return NULL;
 
-        auto offset = Utils::RvaToOffset(boundImportDataDirectory->VirtualAddress(),
-            this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(boundImportDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
         return std::make_unique<ImageBoundImport>(this->bFile, offset);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -358,10 +662,7 @@ auto POEX::PE::GetImageCertificateDirectory() -> std::unique_ptr<ImageCertificat
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& securityDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::Security)];
+        auto securityDataDirectory = GetDataDirectory(DataDirectoryType::Security);
         if (!IsValidDataDirectory(securityDataDirectory))
             return NULL;
 
@@ -369,9 +670,9 @@ auto POEX::PE::GetImageCertificateDirectory() -> std::unique_ptr<ImageCertificat
         // is not an RVA but an raw offset.
         return std::make_unique<ImageCertificateDirectory>(this->bFile, securityDataDirectory->VirtualAddress());
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -379,23 +680,31 @@ auto POEX::PE::GetImageComDescriptor() -> std::unique_ptr<ImageComDescriptor>
 {
     try
     {
-        auto ntHeader = this->GetImageNtHeader();
-        auto dataDirectories = ntHeader.OptionalHeader().DataDirectory();
-        auto& comDescriptorDataDirectory = dataDirectories[static_cast<int>(
-            DataDirectoryType::ComDescriptor)];
+        auto comDescriptorDataDirectory = GetDataDirectory(DataDirectoryType::ComDescriptor);
         if (!IsValidDataDirectory(comDescriptorDataDirectory))
             return NULL;
 
-        auto offset = Utils::RvaToOffset(comDescriptorDataDirectory->VirtualAddress(),
-            this->GetImageSectionHeader());
+        auto offset = Headers().sectionIndex->RvaToOffset(comDescriptorDataDirectory->VirtualAddress());
         if (WRONG_LONG(offset))
             return NULL;
 
         return std::make_unique<ImageComDescriptor>(this->bFile, offset);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
+    }
+}
+
+auto POEX::PE::Parse(const ParseMode& mode) -> std::shared_ptr<const PeModel>
+{
+    try
+    {
+        return std::make_shared<const PeModel>(this->bFile, mode);
+    }
+    catch (const std::exception&)
+    {
+        throw;
     }
 }
 
@@ -403,12 +712,11 @@ auto POEX::PE::Is64Bit() const -> bool
 {
     try
     {
-        return this->bFile->ReadUnsignedShort(this->bFile->ReadUnsignedInt(ELFANEW) + PE_SIGNATURE_UNTIL_MAGIC) 
-            == (unsigned short)FileType::BIT64;
+        return Headers().magic == (unsigned short)FileType::BIT64;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -416,12 +724,11 @@ auto POEX::PE::Is32Bit() const -> bool
 {
     try
     {
-        return this->bFile->ReadUnsignedShort(this->bFile->ReadUnsignedInt(ELFANEW) + PE_SIGNATURE_UNTIL_MAGIC)
-            == (unsigned short)FileType::BIT32;
+        return Headers().magic == (unsigned short)FileType::BIT32;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -432,9 +739,9 @@ auto POEX::PE::IsExe() -> bool
         return (unsigned short)FileCharacteristicsType::ExecutableImage &
             (unsigned short)(FileCharacteristicsType)GetImageNtHeader().FileHeader().Characteristics();
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -445,33 +752,59 @@ auto POEX::PE::IsDll() -> bool
         return (unsigned short)FileCharacteristicsType::Dll &
             (unsigned short)(FileCharacteristicsType)GetImageNtHeader().FileHeader().Characteristics();
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
-auto POEX::PE::SaveFile() -> void
+auto POEX::PE::SaveFile(const SaveMode& mode) -> void
 {
     try
     {
-        if (this->filepath.IsEmpty())
+        if (this->filepath.empty())
             THROW_EXCEPTION("[ERROR] File path is empty.");
-        SaveFile(this->filepath);
+        SaveFile(this->filepath, mode);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
-auto POEX::PE::SaveFile(const CString& filepath) -> void
+auto POEX::PE::SaveFile(const std::filesystem::path& filepath, const SaveMode& mode) -> void
 {
     try
     {
-        std::ofstream ofs(filepath, std::ios::binary | std::ios::out);
-        auto data = this->bFile->Data();
-        ofs.write((const char*)&data[0], data.size());
+        // Ask the backend which file it reads, the stored path only identifies the file of in-memory data.
+        std::error_code error;
+        auto sourceFile = Utils::IsSourceFile(this->bFile, filepath);
+        if (!sourceFile.has_value() && !this->filepath.empty())
+            sourceFile = std::filesystem::equivalent(filepath, this->filepath, error);
+
+        // Any other file gets the whole data, unmodified file-backed ranges are copied by the kernel.
+        if (!std::filesystem::exists(filepath, error) || (sourceFile.has_value() && !sourceFile.value()))
+        {
+            Utils::CopyToFile(this->bFile, 0, this->bFile->Length(), filepath);
+            return;
+        }
+
+        // The data may still be read from this file, so it is never truncated, only replaced as a whole.
+        if (!sourceFile.has_value())
+        {
+            Utils::ReplaceFile(this->bFile, filepath, false);
+            return;
+        }
+
+        // The file the data was read from only needs the ranges written since then.
+        if (this->bFile->DirtyRanges().empty())
+            return;
+        auto size = std::filesystem::file_size(filepath, error);
+        if (mode == SaveMode::InPlace && !error && size == this->bFile->Length())
+            Utils::WriteDirtyRanges(this->bFile, filepath);
+        else
+            Utils::ReplaceFile(this->bFile, filepath);
+        this->bFile->ClearDirtyRanges();
     }
     catch (const std::exception& ex)
     {
@@ -479,6 +812,42 @@ auto POEX::PE::SaveFile(const CString& filepath) -> void
     }
 }
 
+auto POEX::PE::Headers() const -> const HeaderSnapshot&
+{
+    // Rebuild only when a write touched the headers since the last parse.
+    if (this->headers.valid && this->headers.revision == this->bFile->WatchedRevision())
+        return this->headers;
+
+    HeaderSnapshot snapshot;
+    snapshot.ntHeaderOffset = ImageDosHeader(this->bFile).E_lfanew();
+    auto ntHeader = ImageNtHeader(this->bFile, snapshot.ntHeaderOffset);
+    auto fHeader = ntHeader.FileHeader();
+    auto oHeader = ntHeader.OptionalHeader();
+    snapshot.magic = this->bFile->Read<unsigned short>(snapshot.ntHeaderOffset + PE_SIGNATURE_UNTIL_MAGIC);
+    snapshot.dataDirectoryOffset = snapshot.ntHeaderOffset + PE_SIGNATURE_UNTIL_MAGIC +
+        (snapshot.magic == (unsigned short)FileType::BIT64 ? 0x0070 : 0x0060);
+
+    auto offset = snapshot.ntHeaderOffset + ((unsigned int)fHeader.SizeOfOptionalHeader() + PE_SIGNATURE_UNTIL_MAGIC);
+    auto numberOfSection = fHeader.NumberOfSection();
+    auto imageBaseAddress = oHeader.ImageBase();
+    snapshot.sectionTable = std::make_shared<const SectionTable>(this->bFile, offset, numberOfSection, imageBaseAddress);
+    snapshot.sectionIndex = std::make_shared<const SectionIndex>(snapshot.sectionTable);
+
+    // Everything above is read from the DOS header up to the end of the section table.
+    auto headersEnd = static_cast<size_t>(offset) + static_cast<size_t>(numberOfSection) * SECTION_HEADER_SIZE;
+    this->bFile->Watch(std::max<size_t>(headersEnd, ELFANEW + sizeof(unsigned int)));
+    snapshot.revision = this->bFile->WatchedRevision();
+    snapshot.valid = true;
+    this->headers = std::move(snapshot);
+    return this->headers;
+}
+
+auto POEX::PE::GetDataDirectory(const DataDirectoryType& type) const -> std::unique_ptr<ImageDataDirectory>
+{
+    return std::unique_ptr<ImageDataDirectory>(new ImageDataDirectory(this->bFile,
+        Headers().dataDirectoryOffset + static_cast<long>(type) * 0x0008, type));
+}
+
 auto POEX::PE::IsValidDataDirectory(const std::unique_ptr<ImageDataDirectory>& dataDirectory) -> bool
 {
     try
@@ -487,23 +856,39 @@ auto POEX::PE::IsValidDataDirectory(const std::unique_ptr<ImageDataDirectory>& d
             return false;
         return true;
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
-auto POEX::PE::loadFile(const CString& filePath) -> std::vector<byte>
+auto POEX::PE::GetDataDirectoryOffset(const DataDirectoryType& type) -> long
 {
     try
     {
-        if (filePath.IsEmpty())
+        auto dataDirectory = GetDataDirectory(type);
+        if (!IsValidDataDirectory(dataDirectory))
+            return -1;
+        return Headers().sectionIndex->FindOffset(dataDirectory->VirtualAddress());
+    }
+    catch (const std::exception&)
+    {
+        throw;
+    }
+}
+
+auto POEX::PE::loadFile(const std::filesystem::path& filePath) -> std::vector<byte>
+{
+    try
+    {
+        if (filePath.empty())
             THROW_OUT_OF_RANGE("[ERROR] filepath cann't be empty.");
+
+#ifdef _WIN32
         std::ifstream ifs(filePath, std::ios::binary | std::ios::ate);
         if (!ifs)
             THROW_RUNTIME("[ERROR] Reading file fail.");
 
-
         auto end = ifs.tellg();
         ifs.seekg(0, std::ios::beg);
 
@@ -514,12 +899,42 @@ auto POEX::PE::loadFile(const CString& filePath) -> std::vector<byte>
 
         std::vector<byte> buffer(size);
         if (!ifs.read((char*)buffer.data(), buffer.size()))
-            throw std::runtime_error("[ERROR] Reading file fail.");
+            THROW_RUNTIME("[ERROR] Reading file fail.");
+
+        return buffer;
+#else
+        // The size comes from fstat and the data is read straight into the buffer, without stream buffering.
+        auto descriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+            THROW_RUNTIME("[ERROR] Reading file fail.");
+
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+        {
+            close(descriptor);
+            THROW_RUNTIME("[ERROR] Somethings wrong in loading file.");
+        }
 
+        std::vector<byte> buffer(static_cast<size_t>(status.st_size));
+        size_t done = 0;
+        while (done < buffer.size())
+        {
+            auto count = pread(descriptor, buffer.data() + done, buffer.size() - done, static_cast<off_t>(done));
+            if (count < 0 && errno == EINTR)
+                continue;
+            if (count <= 0)
+            {
+                close(descriptor);
+                THROW_RUNTIME("[ERROR] Reading file fail.");
+            }
+            done += static_cast<size_t>(count);
+        }
+        close(descriptor);
         return buffer;
+#endif
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
@@ -11,16 +11,28 @@
 #include "Headers/ImageLoadConfigDirectory.h"
 #include "Headers/ImageExceptionDirectory.h"
 #include "Headers/ImageResourceDirectory.h"
+#include "Headers/RuntimeFunctionIndex.h"
 #include "Headers/ImageExportDirectory.h"
 #include "Headers/ImageImportDirectory.h"
 #include "Headers/ImageDebugDirectory.h"
 #include "Headers/ImageBaseRelocation.h"
 #include "Headers/ImageComDescriptor.h"
 #include "Headers/ImageSectionHeader.h"
+#include "Headers/FunctionStartIndex.h"
 #include "Headers/ImageTlsDirectory.h"
 #include "Headers/ImageBoundImport.h"
+#include "Headers/ExportSymbolizer.h"
+#include "Headers/ArchitectureView.h"
 #include "Headers/ImageDosHeader.h"
 #include "Headers/ImageNtHeader.h"
+#include "Headers/ResourceTree.h"
+#include "Headers/SectionIndex.h"
+#include "Headers/ExportIndex.h"
+#include "Headers/PatchedFile.h"
+#include "Headers/MappedFile.h"
+#include "Headers/BatchLoader.h"
+#include "Headers/LazyFile.h"
+#include "Headers/PeModel.h"
 #include "Headers/IRaw.h"
 
 namespace POEX
@@ -34,11 +46,32 @@ namespace POEX
 		/// <param name="raw">PE raw data</param>
 		PE(const std::vector<byte>& raw);
 
+		/// <summary>
+		/// Constructor, take the ownership of raw data without copying it
+		/// </summary>
+		/// <param name="raw">PE raw data</param>
+		PE(std::vector<byte>&& raw);
+
+		/// <summary>
+		/// Constructor, borrow the raw data without copying it.
+		/// The caller must keep the memory alive and unchanged while the PE uses it.
+		/// </summary>
+		/// <param name="raw">Pointer to the PE raw data</param>
+		/// <param name="length">Length of the PE raw data</param>
+		PE(const byte* raw, const size_t& length);
+
 		/// <summary>
 		/// Constructor
 		/// </summary>
-		/// <param name="filepath">PE file path</param>
-		PE(CString filepath);
+		/// <param name="raw">Custom IRaw implementation holding the PE data</param>
+		PE(const std::shared_ptr<IRaw>& raw);
+
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="filepath">PE file path, UTF-8 on POSIX systems</param>
+		/// <param name="accessType">Read the whole file, map it or read it on demand</param>
+		PE(const std::filesystem::path& filepath, const FileAccessType& accessType = FileAccessType::Buffered);
 
 		/// Destructor
 		~PE() = default;
@@ -61,6 +94,18 @@ namespace POEX
 		/// <returns>List of all Image Section Header</returns>
 		auto GetImageSectionHeader()-> std::vector<std::shared_ptr<ImageSectionHeader>>;
 
+		/// <summary>
+		/// Get flat copy of the section table
+		/// </summary>
+		/// <returns>Section table, shared with all directories of this PE</returns>
+		auto GetSectionTable()->std::shared_ptr<const SectionTable>;
+
+		/// <summary>
+		/// Get index of the sections for RVA/VA to file offset translation
+		/// </summary>
+		/// <returns>Section index, shared with all directories of this PE</returns>
+		auto GetSectionIndex()->std::shared_ptr<const SectionIndex>;
+
 		/// <summary>
 		/// Access to Image Export Directory and Export Functions
 		/// </summary>
@@ -73,6 +118,13 @@ namespace POEX
 		/// <returns>List of all Image Directory Table exist in PE.</returns>
 		auto GetImageImportDirectory()->std::vector<std::unique_ptr<ImageImportDirectory>>;
 
+		/// <summary>
+		/// Lazy range over the Import Directory Table, each descriptor is read only when it is reached.
+		/// Use ImageImportDirectory::ImportedFunctions to walk its functions the same way.
+		/// </summary>
+		/// <returns>Range of ImageImportDirectory</returns>
+		auto GetImportDescriptors()->ImportDescriptorRange;
+
 		/// <summary>
 		/// The resource directory contains icons, mouse pointer, string language files etc. 
 		/// which are used by the application.
@@ -80,12 +132,37 @@ namespace POEX
 		/// <returns></returns>
 		auto GetImageResourceDirectory() -> std::unique_ptr<ImageResourceDirectory>;
 
+		/// <summary>
+		/// View over the payload of a resource data entry.
+		/// Points into the file data without copying when it is one contiguous block (Buffered, Mapped without edits),
+		/// otherwise only the payload is read into storage. The view becomes invalid after any write to the PE.
+		/// </summary>
+		/// <param name="data">Data node of the resource tree</param>
+		/// <param name="storage">Holds the payload when it can't be viewed in place, must outlive the view</param>
+		/// <returns>View over the payload, empty when the entry isn't in the file</returns>
+		auto GetResourceData(const ResourceNode& data, std::vector<byte>& storage) -> ByteView;
+
+		/// <summary>
+		/// Write the payload of every resource to its own file, named type_name_language.bin.
+		/// Names which end up the same after sanitizing get a _2, _3, ... suffix, so no file is overwritten.
+		/// Unmodified payloads of Mapped and Lazy files are copied file to file by the kernel.
+		/// </summary>
+		/// <param name="directory">Output directory, created when it doesn't exist</param>
+		/// <returns>Number of written files, entries which aren't in the file are skipped</returns>
+		auto ExtractResources(const std::filesystem::path& directory) -> size_t;
+
 		/// <summary>
 		/// Access to Image Exception Directory Table
 		/// </summary>
 		/// <returns></returns>
 		auto GetImageExceptionDirectory() -> std::unique_ptr<ImageExceptionDirectory>;
 
+		/// <summary>
+		/// Sorted index over the RUNTIME_FUNCTION entries of an x64 PE, for function lookups and unwinding.
+		/// </summary>
+		/// <returns>Index, NULL when the PE isn't x64 or has no exception directory</returns>
+		auto GetRuntimeFunctionIndex() -> std::unique_ptr<RuntimeFunctionIndex>;
+
 		/// <summary>
 		/// Access to Image TLS Directory
 		/// </summary>
@@ -104,6 +181,21 @@ namespace POEX
 		/// <returns></returns>
 		auto GetImageBaseRelocation() -> std::vector<std::unique_ptr<ImageBaseRelocation>>;
 
+		/// <summary>
+		/// Entries of all base relocation blocks decoded into one packed array, in block order.
+		/// </summary>
+		/// <returns>List of relocations</returns>
+		auto GetRelocations() -> std::vector<RelocationEntry>;
+
+		/// <summary>
+		/// Relocate the image to another base address: every base relocation is patched with the
+		/// difference to the current ImageBase, then ImageBase is updated.
+		/// Locations in uninitialized data aren't in the file and are skipped.
+		/// </summary>
+		/// <param name="newImageBase">New base address</param>
+		/// <returns></returns>
+		auto Rebase(const unsigned long long& newImageBase) -> void;
+
 		/// <summary>
 		/// Access to Delay Import Descriptor
 		/// </summary>
@@ -134,6 +226,73 @@ namespace POEX
 		/// <returns>Pointer of ImageComDescriptor</returns>
 		auto GetImageComDescriptor() -> std::unique_ptr<ImageComDescriptor>;
 
+		/// <summary>
+		/// Parse the headers and every data directory in a single pass into an immutable model.
+		/// The model holds copies of everything it returns, so later writes to the PE don't change it,
+		/// and it can be shared between threads.
+		/// </summary>
+		/// <param name="mode">Throw on malformed structures, or skip them and report them by PeModel::Diagnostics</param>
+		/// <returns>Pointer of PeModel</returns>
+		auto Parse(const ParseMode& mode = ParseMode::Strict) -> std::shared_ptr<const PeModel>;
+
+		/// <summary>
+		/// Call the visitor once with the architecture of the PE, Pe32() or Pe64().
+		/// The views of that architecture then read every field at a fixed offset and width, e.g.
+		/// pe.Dispatch([&](auto architecture) { return pe.GetOptionalHeaderView&lt;decltype(architecture)&gt;().ImageBase(); })
+		/// </summary>
+		/// <param name="visitor">Generic callable which takes Pe32 or Pe64</param>
+		/// <returns>Result of the visitor</returns>
+		template <typename Visitor>
+		auto Dispatch(Visitor&& visitor) -> std::common_type_t<decltype(visitor(Pe32())), decltype(visitor(Pe64()))>
+		{
+			if (Is64Bit())
+				return visitor(Pe64());
+			return visitor(Pe32());
+		}
+
+		/// <summary>
+		/// Optional header view of an architecture, throws when the PE has the other one.
+		/// </summary>
+		/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+		/// <returns>View over the optional header</returns>
+		template <typename Architecture>
+		auto GetOptionalHeaderView() -> OptionalHeaderView<Architecture>
+		{
+			return OptionalHeaderView<Architecture>(this->bFile, Headers().ntHeaderOffset + 0x0018);
+		}
+
+		/// <summary>
+		/// TLS directory view of an architecture, throws when the PE has the other one.
+		/// </summary>
+		/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+		/// <returns>View over the TLS directory, empty when the PE has none</returns>
+		template <typename Architecture>
+		auto GetTlsDirectoryView() -> std::optional<TlsDirectoryView<Architecture>>
+		{
+			if (Headers().magic != Architecture::Magic)
+				THROW_EXCEPTION("[ERROR] optional header magic doesn't match the architecture.");
+			auto offset = GetDataDirectoryOffset(DataDirectoryType::TLS);
+			if (offset < 0)
+				return std::nullopt;
+			return TlsDirectoryView<Architecture>(this->bFile, offset);
+		}
+
+		/// <summary>
+		/// Load config directory view of an architecture, throws when the PE has the other one.
+		/// </summary>
+		/// <typeparam name="Architecture">Pe32 or Pe64</typeparam>
+		/// <returns>View over the load config directory, empty when the PE has none</returns>
+		template <typename Architecture>
+		auto GetLoadConfigDirectoryView() -> std::optional<LoadConfigDirectoryView<Architecture>>
+		{
+			if (Headers().magic != Architecture::Magic)
+				THROW_EXCEPTION("[ERROR] optional header magic doesn't match the architecture.");
+			auto offset = GetDataDirectoryOffset(DataDirectoryType::LoadConfig);
+			if (offset < 0)
+				return std::nullopt;
+			return LoadConfigDirectoryView<Architecture>(this->bFile, offset);
+		}
+
 		/// <summary>
 		/// Is the PE 64bit file?
 		/// </summary>
@@ -159,26 +318,49 @@ namespace POEX
 		auto IsDll() ->bool;
 
 		/// <summary>
-		/// Save the applied changes to the file
+		/// Save the applied changes to the file, only the changed ranges are written.
+		/// Expects that the file wasn't changed by anyone else since it was opened.
 		/// </summary>
+		/// <param name="mode">Write the changes into the file or replace it atomically</param>
 		/// <returns></returns>
-		auto SaveFile() ->void;
+		auto SaveFile(const SaveMode& mode = SaveMode::InPlace) ->void;
 
 		/// <summary>
-		/// Save the applied changes to the file
+		/// Save the applied changes to the file.
+		/// The file the data is still read from is recognized by its descriptor and never truncated.
 		/// </summary>
 		/// <param name="filepath">Save as another file(Keep original file)</param>
+		/// <param name="mode">How the file the PE was opened from is written, when filepath is that file</param>
 		/// <returns></returns>
-		auto SaveFile(const CString& filepath)->void;
+		auto SaveFile(const std::filesystem::path& filepath, const SaveMode& mode = SaveMode::InPlace)->void;
 
 	private:
 		PE() = default;
 
-		CString filepath;
-		std::shared_ptr<BufferFile> bFile;
+		/// <summary>
+		/// Header values every getter needs, parsed once and kept until the headers are written.
+		/// </summary>
+		struct HeaderSnapshot
+		{
+			long ntHeaderOffset = 0;
+			long dataDirectoryOffset = 0;
+			unsigned short magic = 0;
+			std::shared_ptr<const SectionTable> sectionTable;
+			std::shared_ptr<const SectionIndex> sectionIndex;
+			std::vector<std::shared_ptr<ImageSectionHeader>> sectionHeaders;
+			unsigned long long revision = 0;
+			bool valid = false;
+		};
+
+		std::filesystem::path filepath;
+		std::shared_ptr<IRaw> bFile;
+		mutable HeaderSnapshot headers;
 
+		auto Headers() const -> const HeaderSnapshot&;
+		auto GetDataDirectory(const DataDirectoryType& type) const -> std::unique_ptr<ImageDataDirectory>;
 		auto IsValidDataDirectory(const std::unique_ptr<ImageDataDirectory>& dataDirectory) -> bool;
-		auto loadFile(const CString& filePath)->std::vector<byte>;
+		auto GetDataDirectoryOffset(const DataDirectoryType& type) -> long;
+		auto loadFile(const std::filesystem::path& filePath)->std::vector<byte>;
 	};
 }
 
@@ -0,0 +1,477 @@
+#include "../Headers/BatchLoader.h"
+#include "../Headers/ImageNtHeader.h"
+#include "../Headers/SectionIndex.h"
+#include <algorithm>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+/// <summary>
+/// Submission and completion queues shared with the kernel, set up with the raw system calls.
+/// </summary>
+struct BatchLoader::Ring
+{
+#ifdef __linux__
+	int descriptor = -1;
+	unsigned int entries = 0;
+	unsigned int submitted = 0;
+	unsigned int* sqHead = nullptr;
+	unsigned int* sqTail = nullptr;
+	unsigned int* sqMask = nullptr;
+	unsigned int* sqArray = nullptr;
+	unsigned int* cqHead = nullptr;
+	unsigned int* cqTail = nullptr;
+	unsigned int* cqMask = nullptr;
+	io_uring_sqe* sqes = nullptr;
+	io_uring_cqe* cqes = nullptr;
+	void* sqRing = MAP_FAILED;
+	void* cqRing = MAP_FAILED;
+	size_t sqRingSize = 0;
+	size_t cqRingSize = 0;
+	size_t sqesSize = 0;
+
+	explicit Ring(const unsigned int& depth)
+	{
+		io_uring_params params = {};
+		this->descriptor = static_cast<int>(syscall(__NR_io_uring_setup, depth, &params));
+		if (this->descriptor < 0)
+			THROW_RUNTIME("[ERROR] io_uring isn't available.");
+
+		this->entries = params.sq_entries;
+		this->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+		this->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		auto singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMap)
+			this->sqRingSize = this->cqRingSize = std::max(this->sqRingSize, this->cqRingSize);
+
+		this->sqRing = mmap(nullptr, this->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			this->descriptor, IORING_OFF_SQ_RING);
+		this->cqRing = singleMap ? this->sqRing : mmap(nullptr, this->cqRingSize, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, this->descriptor, IORING_OFF_CQ_RING);
+		this->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		auto sqes = mmap(nullptr, this->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			this->descriptor, IORING_OFF_SQES);
+		if (this->sqRing == MAP_FAILED || this->cqRing == MAP_FAILED || sqes == MAP_FAILED)
+		{
+			if (sqes != MAP_FAILED)
+				munmap(sqes, this->sqesSize);
+			Close();
+			THROW_RUNTIME("[ERROR] io_uring isn't available.");
+		}
+
+		auto sq = static_cast<byte*>(this->sqRing);
+		auto cq = static_cast<byte*>(this->cqRing);
+		this->sqHead = reinterpret_cast<unsigned int*>(sq + params.sq_off.head);
+		this->sqTail = reinterpret_cast<unsigned int*>(sq + params.sq_off.tail);
+		this->sqMask = reinterpret_cast<unsigned int*>(sq + params.sq_off.ring_mask);
+		this->sqArray = reinterpret_cast<unsigned int*>(sq + params.sq_off.array);
+		this->cqHead = reinterpret_cast<unsigned int*>(cq + params.cq_off.head);
+		this->cqTail = reinterpret_cast<unsigned int*>(cq + params.cq_off.tail);
+		this->cqMask = reinterpret_cast<unsigned int*>(cq + params.cq_off.ring_mask);
+		this->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+		this->sqes = static_cast<io_uring_sqe*>(sqes);
+	}
+
+	~Ring()
+	{
+		if (this->sqes != nullptr)
+			munmap(this->sqes, this->sqesSize);
+		Close();
+	}
+
+	auto Close() -> void
+	{
+		if (this->cqRing != MAP_FAILED && this->cqRing != this->sqRing)
+			munmap(this->cqRing, this->cqRingSize);
+		if (this->sqRing != MAP_FAILED)
+			munmap(this->sqRing, this->sqRingSize);
+		if (this->descriptor >= 0)
+			close(this->descriptor);
+		this->sqRing = this->cqRing = MAP_FAILED;
+		this->descriptor = -1;
+	}
+
+	/// <summary>
+	/// Queue a read, the caller never has more reads in flight than the ring has entries.
+	/// </summary>
+	auto Push(const int& file, byte* buffer, const size_t& size, const size_t& offset, void* data) -> void
+	{
+		auto tail = *this->sqTail;
+		auto index = tail & *this->sqMask;
+		auto& sqe = this->sqes[index];
+		sqe = {};
+		sqe.opcode = IORING_OP_READ;
+		sqe.fd = file;
+		sqe.addr = reinterpret_cast<unsigned long long>(buffer);
+		sqe.len = static_cast<unsigned int>(size);
+		sqe.off = offset;
+		sqe.user_data = reinterpret_cast<unsigned long long>(data);
+		this->sqArray[index] = index;
+		__atomic_store_n(this->sqTail, tail + 1, __ATOMIC_RELEASE);
+		this->submitted++;
+	}
+
+	/// <summary>
+	/// Submit the queued reads and wait for at least one completion.
+	/// </summary>
+	auto Enter() -> void
+	{
+		if (!TryEnter())
+			THROW_RUNTIME("[ERROR] Reading file fail.");
+	}
+
+	/// <summary>
+	/// Enter without throwing, for cleanup paths.
+	/// </summary>
+	/// <returns>False when the kernel refused the call</returns>
+	auto TryEnter() noexcept -> bool
+	{
+		while (syscall(__NR_io_uring_enter, this->descriptor, this->submitted, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0)
+			if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+				return false;
+		this->submitted = 0;
+		return true;
+	}
+
+	/// <summary>
+	/// Take the available completions.
+	/// </summary>
+	template <typename Function>
+	auto Reap(const Function& function) -> void
+	{
+		auto head = *this->cqHead;
+		auto tail = __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE);
+		for (; head != tail; head++)
+		{
+			auto& cqe = this->cqes[head & *this->cqMask];
+			function(reinterpret_cast<void*>(cqe.user_data), cqe.res);
+		}
+		__atomic_store_n(this->cqHead, head, __ATOMIC_RELEASE);
+	}
+#endif
+};
+
+namespace
+{
+	/// <summary>
+	/// Read a range with pread, as much of it as the file has.
+	/// </summary>
+	/// <returns>Number of bytes read, negative errno on failure</returns>
+	auto ReadRange(const int& file, byte* buffer, const size_t& size, const size_t& offset) -> long long
+	{
+#ifdef _WIN32
+		return -1;
+#else
+		size_t done = 0;
+		while (done < size)
+		{
+			auto count = pread(file, buffer + done, size - done, static_cast<off_t>(offset + done));
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count < 0)
+				return -errno;
+			if (count == 0)
+				break;
+			done += static_cast<size_t>(count);
+		}
+		return static_cast<long long>(done);
+#endif
+	}
+}
+
+BatchLoader::BatchLoader(const std::vector<DataDirectoryType>& directories, const unsigned int& queueDepth,
+	const size_t& cachedPages) : directories(directories), queueDepth(std::max(queueDepth, 1u)),
+	cachedPages(std::max<size_t>(cachedPages, 1))
+{
+#ifdef __linux__
+	try
+	{
+		this->ring = std::make_unique<Ring>(this->queueDepth);
+	}
+	catch (const std::exception&)
+	{
+		// Kernels without io_uring or with io_uring disabled, the reads are done with pread.
+		this->ring = nullptr;
+	}
+#endif
+}
+
+BatchLoader::~BatchLoader() = default;
+
+auto BatchLoader::UsesIoUring() const -> bool
+{
+	return this->ring != nullptr;
+}
+
+auto BatchLoader::Load(const std::vector<std::filesystem::path>& files, const Callback& callback)
+	-> std::vector<std::filesystem::path>
+{
+	std::vector<std::filesystem::path> failed;
+	std::vector<std::unique_ptr<Pending>> pendings;
+
+	// Read the next pages of a file, or hand it out when nothing is missing anymore.
+	auto advance = [&](Pending& pending)
+	{
+		auto pages = Plan(pending);
+		if (pages.empty())
+		{
+			auto filepath = pending.filepath;
+			auto file = pending.file;
+			pendings.erase(std::find_if(pendings.begin(), pendings.end(),
+				[&pending](const std::unique_ptr<Pending>& p) { return p.get() == &pending; }));
+			callback(filepath, file);
+			return;
+		}
+
+		// Consecutive pages are read at once.
+		std::sort(pages.begin(), pages.end());
+		for (size_t i = 0; i < pages.size();)
+		{
+			auto last = i + 1;
+			while (last < pages.size() && pages[last] == pages[last - 1] + 1)
+				last++;
+
+			auto read = std::make_unique<Read>();
+			read->pending = &pending;
+			read->offset = pages[i] * LazyFile::PageSize;
+			read->buffer.resize(std::min((last - i) * LazyFile::PageSize, pending.file->Length() - read->offset));
+			pending.requested.insert(pending.requested.end(), pages.begin() + i, pages.begin() + last);
+			pending.reads++;
+			this->queued.push_back(std::move(read));
+			i = last;
+		}
+	};
+
+	try
+	{
+		size_t next = 0;
+		while (true)
+		{
+			// Keep a window of open files, every file has at least one read in flight until it is handed out.
+			while (next < files.size() && pendings.size() < this->queueDepth)
+			{
+				auto pending = std::make_unique<Pending>();
+				pending->filepath = files[next++];
+				try
+				{
+					pending->file = std::make_shared<LazyFile>(pending->filepath, this->cachedPages);
+				}
+				catch (const std::exception&)
+				{
+					failed.push_back(pending->filepath);
+					continue;
+				}
+				pendings.push_back(std::move(pending));
+				advance(*pendings.back());
+			}
+
+			if (this->queued.empty() && this->inFlight.empty())
+			{
+				if (next < files.size())
+					continue;
+				break;
+			}
+
+			Submit();
+			for (auto& read : Wait())
+			{
+				auto& pending = *read->pending;
+				pending.reads--;
+				if (read->result < 0)
+					pending.failed = true;
+				else if (!pending.failed)
+					pending.file->Prime(read->offset, read->buffer.data(), static_cast<size_t>(read->result));
+
+				if (pending.reads != 0)
+					continue;
+				if (!pending.failed)
+				{
+					advance(pending);
+					continue;
+				}
+
+				failed.push_back(pending.filepath);
+				pendings.erase(std::find_if(pendings.begin(), pendings.end(),
+					[&pending](const std::unique_ptr<Pending>& p) { return p.get() == &pending; }));
+			}
+		}
+	}
+	catch (const std::exception&)
+	{
+		// The kernel may still write into the buffers of the reads in flight.
+		this->queued.clear();
+		Drain();
+		throw;
+	}
+	return failed;
+}
+
+auto BatchLoader::Plan(Pending& pending) -> std::vector<size_t>
+{
+	std::vector<size_t> pages;
+	auto length = pending.file->Length();
+	if (pending.file->FileDescriptor(0, length) < 0)
+		return pages;
+
+	try
+	{
+		// Every step only reads bytes of pages which are already cached, a missing range ends the plan.
+		std::shared_ptr<IRaw> file = pending.file;
+		Missing(pending, 0, ELFANEW + sizeof(unsigned int), pages);
+		if (!pages.empty())
+			return pages;
+
+		long ntHeaderOffset = file->Read<unsigned int>(ELFANEW);
+		Missing(pending, ntHeaderOffset, PE_SIGNATURE_UNTIL_MAGIC, pages);
+		if (!pages.empty())
+			return pages;
+
+		auto ntHeader = ImageNtHeader(file, ntHeaderOffset);
+		auto fileHeader = ntHeader.FileHeader().Snapshot();
+		auto sectionTableOffset = ntHeaderOffset + PE_SIGNATURE_UNTIL_MAGIC + static_cast<long>(fileHeader.SizeOfOptionalHeader);
+		Missing(pending, ntHeaderOffset, sectionTableOffset - ntHeaderOffset +
+			static_cast<long long>(fileHeader.NumberOfSections) * SECTION_HEADER_SIZE, pages);
+		if (!pages.empty() || this->directories.empty())
+			return pages;
+
+		auto optionalHeader = ntHeader.OptionalHeader().Snapshot();
+		auto sectionIndex = SectionIndex(std::make_shared<const SectionTable>(file, sectionTableOffset,
+			fileHeader.NumberOfSections, optionalHeader.ImageBase));
+		for (const auto& type : this->directories)
+		{
+			auto index = static_cast<unsigned int>(type);
+			if (index >= std::min(optionalHeader.NumberOfRvaAndSizes, 16u))
+				continue;
+
+			const auto& directory = optionalHeader.DataDirectory[index];
+			if (directory.VirtualAddress == 0 || directory.Size == 0)
+				continue;
+
+			// The certificate table is addressed by file offset instead of RVA.
+			auto offset = type == DataDirectoryType::Security ? static_cast<long>(directory.VirtualAddress) :
+				sectionIndex.FindOffset(directory.VirtualAddress);
+			if (offset >= 0)
+				Missing(pending, offset, directory.Size, pages);
+		}
+	}
+	catch (const std::exception&)
+	{
+		// Malformed headers, whatever was planned is read and parsing the file reports the error.
+	}
+	return pages;
+}
+
+auto BatchLoader::Missing(Pending& pending, const long long& offset, const long long& size, std::vector<size_t>& pages) -> void
+{
+	auto length = static_cast<long long>(pending.file->Length());
+	if (offset < 0 || size <= 0 || offset >= length)
+		return;
+
+	// Pages which were read already are never read again, even if the read came back short.
+	auto first = static_cast<size_t>(offset) / LazyFile::PageSize;
+	auto last = static_cast<size_t>(std::min(offset + size, length) - 1) / LazyFile::PageSize;
+	for (auto page = first; page <= last; page++)
+	{
+		if (pending.requested.size() + pages.size() >= this->cachedPages)
+			return;
+		if (std::find(pending.requested.begin(), pending.requested.end(), page) == pending.requested.end() &&
+			std::find(pages.begin(), pages.end(), page) == pages.end())
+			pages.push_back(page);
+	}
+}
+
+auto BatchLoader::Submit() -> void
+{
+	while (!this->queued.empty() && this->inFlight.size() < this->queueDepth)
+	{
+		auto& read = this->queued.front();
+		auto file = read->pending->file->FileDescriptor(0, read->pending->file->Length());
+#ifdef __linux__
+		if (this->ring != nullptr)
+			this->ring->Push(file, read->buffer.data(), read->buffer.size(), read->offset, read.get());
+#endif
+#ifndef _WIN32
+		// Let the kernel start every read of the window before the first pread blocks.
+		if (this->ring == nullptr)
+			posix_fadvise(file, static_cast<off_t>(read->offset), static_cast<off_t>(read->buffer.size()), POSIX_FADV_WILLNEED);
+#endif
+		this->inFlight.push_back(std::move(read));
+		this->queued.pop_front();
+	}
+}
+
+auto BatchLoader::Drain() noexcept -> void
+{
+#ifdef __linux__
+	while (this->ring != nullptr && !this->inFlight.empty())
+	{
+		// When the kernel can't be asked any more, closing the ring cancels the reads before the buffers go.
+		if (!this->ring->TryEnter())
+		{
+			this->ring.reset();
+			break;
+		}
+		this->ring->Reap([this](void* data, const int&)
+		{
+			this->inFlight.erase(std::find_if(this->inFlight.begin(), this->inFlight.end(),
+				[data](const std::unique_ptr<Read>& r) { return r.get() == data; }));
+		});
+	}
+#endif
+	this->inFlight.clear();
+}
+
+auto BatchLoader::Wait() -> std::vector<std::unique_ptr<Read>>
+{
+	std::vector<std::unique_ptr<Read>> completed;
+#ifdef __linux__
+	if (this->ring != nullptr)
+	{
+		this->ring->Enter();
+		this->ring->Reap([this, &completed](void* data, const int& result)
+		{
+			auto read = std::find_if(this->inFlight.begin(), this->inFlight.end(),
+				[data](const std::unique_ptr<Read>& r) { return r.get() == data; });
+			(*read)->result = result;
+			completed.push_back(std::move(*read));
+			this->inFlight.erase(read);
+		});
+
+		// Short or failed reads (e.g. a kernel without IORING_OP_READ) are finished with pread.
+		for (auto& read : completed)
+		{
+			auto size = read->buffer.size();
+			if (read->result >= 0 && static_cast<size_t>(read->result) == size)
+				continue;
+			auto file = read->pending->file->FileDescriptor(0, read->pending->file->Length());
+			auto done = read->result > 0 ? static_cast<size_t>(read->result) : 0;
+			auto count = ReadRange(file, read->buffer.data() + done, size - done, read->offset + done);
+			read->result = count < 0 ? count : static_cast<long long>(done) + count;
+		}
+		return completed;
+	}
+#endif
+
+	for (auto& read : this->inFlight)
+	{
+		auto file = read->pending->file->FileDescriptor(0, read->pending->file->Length());
+		read->result = ReadRange(file, read->buffer.data(), read->buffer.size(), read->offset);
+		completed.push_back(std::move(read));
+	}
+	this->inFlight.clear();
+	return completed;
+}
@@ -6,30 +6,73 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-BufferFile::BufferFile(const std::vector<byte>& data) : data(data)
+BufferFile::BufferFile(const std::vector<byte>& data) : data(data), view(this->data.data()), length(this->data.size())
 {
+	Contiguous(this->view, this->length);
 }
 
-BufferFile::BufferFile(const BufferFile& bFile) : data(bFile.data)
+BufferFile::BufferFile(std::vector<byte>&& data) : data(std::move(data)), view(this->data.data()), length(this->data.size())
 {
+	Contiguous(this->view, this->length);
+}
+
+BufferFile::BufferFile(const byte* data, const size_t& length) : view(data), length(length)
+{
+	if (data == nullptr && length != 0)
+		THROW_OUT_OF_RANGE("[ERROR] data cann't be empty.");
+	Contiguous(this->view, this->length);
+}
+
+BufferFile::BufferFile(const std::shared_ptr<const std::vector<byte>>& data) : borrowed(data)
+{
+	if (data == nullptr)
+		THROW_OUT_OF_RANGE("[ERROR] data cann't be empty.");
+	this->view = data->data();
+	this->length = data->size();
+	Contiguous(this->view, this->length);
+}
+
+BufferFile::BufferFile(const BufferFile& bFile)
+{
+	*this = bFile;
 }
 
 auto BufferFile::operator=(const BufferFile& bFile) -> void
 {
 	this->data = bFile.data;
+	this->borrowed = bFile.borrowed;
+	this->length = bFile.length;
+	// A borrowed view stays shared, owned data points to our own copy.
+	this->view = bFile.view == bFile.data.data() ? this->data.data() : bFile.view;
+	Contiguous(this->view, this->length);
 }
 
 auto BufferFile::SubArray(const long& offset, const int& length) -> std::vector<byte>
 {
 	try
 	{
-		auto firstIt = data.begin() + offset;
-		auto laseIt = data.begin() + offset + length;
-		return std::vector<byte>(firstIt, laseIt);
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		CheckRange(offset, length);
+		return std::vector<byte>(this->view + offset, this->view + offset + length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto BufferFile::ReadBytes(const long& offset, byte* destination, const size_t& length) -> void
+{
+	try
+	{
+		CheckRange(offset, length);
+		if (length != 0)
+			std::memcpy(destination, this->view + offset, length);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -37,13 +80,11 @@ auto BufferFile::ReadByte(const long& offset) -> byte
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		return this->data[offset];
+		return ReadValue<byte>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -51,13 +92,11 @@ auto BufferFile::ReadUnsignedShort(const long& offset) -> unsigned short
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		return BytesArrayTo<unsigned short>(this->data, offset);
+		return ReadValue<unsigned short>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,13 +104,11 @@ auto BufferFile::ReadUnsignedInt(const long& offset) -> unsigned int
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		return BytesArrayTo<unsigned int>(this->data, offset);
+		return ReadValue<unsigned int>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -79,13 +116,11 @@ auto BufferFile::ReadUnsignedLong(const long& offset) -> unsigned long
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		return BytesArrayTo<unsigned long>(this->data, offset);
+		return ReadValue<unsigned long>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -93,13 +128,11 @@ auto BufferFile::WriteByte(const long& offset, const byte& value) -> void
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		this->data[offset] = value;
+		WriteValue<byte>(offset, value);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -107,18 +140,16 @@ auto BufferFile::WriteBytes(const long& offset, const std::vector<byte>& bytes)
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_EXCEPTION("[ERROR] offset value is wrong.");
 		if (EMPTY_VECTOR(bytes))
 			THROW_OUT_OF_RANGE("[ERROR] data cann't be empty.");
-		auto position = std::next(this->data.cbegin(), offset);
-		this->data.erase(position, position + 8);
-		position = std::next(this->data.cbegin(), offset);
-		this->data.insert(position, bytes.begin(), bytes.end());
+		CheckRange(offset, bytes.size());
+		Own();
+		std::memcpy(this->data.data() + offset, bytes.data(), bytes.size());
+		Written(offset, bytes.size());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -126,13 +157,11 @@ auto BufferFile::WriteUnsignedShort(const long& offset, const unsigned short& va
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		this->WriteByte(offset, (byte)value);
+		WriteValue<unsigned short>(offset, value);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -140,13 +169,11 @@ auto BufferFile::WriteUnsignedLong(const long& offset, const unsigned long& valu
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		this->WriteByte(offset, (byte)value);
+		WriteValue<unsigned long>(offset, value);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -154,13 +181,11 @@ auto BufferFile::WriteUnsignedInt(const long& offset, const unsigned int& value)
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		this->WriteByte(offset, (byte)value);
+		WriteValue<unsigned int>(offset, value);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -168,14 +193,20 @@ auto BufferFile::ReadUnicodeString(const long& offset) -> std::wstring
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		auto item = this->data[offset];
-		return std::wstring((wchar_t*)item);
+		CheckRange(offset, sizeof(unsigned short));
+		std::wstring str;
+		for (auto pos = static_cast<size_t>(offset); pos + 1 < this->length; pos += 2)
+		{
+			auto character = static_cast<wchar_t>(this->view[pos] | (this->view[pos + 1] << 8));
+			if (character == 0x0000)
+				break;
+			str.push_back(character);
+		}
+		return str;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -183,16 +214,21 @@ auto BufferFile::ReadUnicodeString(const long& offset, const long& length) -> st
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		if (WRONG_LONG(length))
+		if (length < 0)
 			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
-		auto vec = GetSubVector(this->data, offset, offset + length);
-		return std::wstring((wchar_t*)&vec[0], vec.size());
+		CheckRange(offset, static_cast<size_t>(length) * 2);
+		std::wstring str;
+		str.reserve(length);
+		for (long i = 0; i < length; i++)
+		{
+			auto pos = offset + i * 2;
+			str.push_back(static_cast<wchar_t>(this->view[pos] | (this->view[pos + 1] << 8)));
+		}
+		return str;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -200,32 +236,25 @@ auto BufferFile::ReadAsciiString(const long& offset) -> std::string
 {
 	try
 	{
-		if (WRONG_LONG(offset))
-			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
-		std::vector<byte> str;
-		auto pos = offset;
-		while (this->data[pos] != 0x00)
-		{
-			str.push_back(this->data[pos]);
-			pos++;
-		}
-
-		return std::string(str.begin(), str.end());
+		CheckRange(offset, sizeof(byte));
+		auto begin = reinterpret_cast<const char*>(this->view + offset);
+		auto end = static_cast<const char*>(std::memchr(begin, 0x00, this->length - offset));
+		return end == nullptr ? std::string(begin, this->length - offset) : std::string(begin, end);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto BufferFile::Data() -> std::vector<byte>
+auto BufferFile::Data() -> ByteView
 {
-	return this->data;
+	return ByteView{ this->view, this->length };
 }
 
 auto BufferFile::Length() -> size_t
 {
-	return this->data.size();
+	return this->length;
 }
 
 auto BufferFile::RemoveRange(const long& offset, const unsigned long length) -> void
@@ -234,27 +263,37 @@ auto BufferFile::RemoveRange(const long& offset, const unsigned long length) ->
 	{
 		if (WRONG_LONG(offset))
 			THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+		CheckRange(offset, length);
+		Own();
+		// Everything after offset moves.
+		Written(offset, this->length - offset);
 		auto startPosition = std::next(this->data.cbegin(), offset);
 		auto pos = offset + length;
 		auto endPosition = std::next(this->data.cbegin(), pos);
 		this->data.erase(startPosition, endPosition);
+		this->view = this->data.data();
+		this->length = this->data.size();
+		Contiguous(this->view, this->length);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto BufferFile::GetSubVector(const std::vector<byte>& vec, const long& startPosition, const long& endPosition) -> std::vector<byte>
+auto BufferFile::CheckRange(const long& offset, const size_t& size) const -> void
 {
-	try
-	{
-		auto begin = vec.begin() + startPosition;
-		auto end = vec.begin() + endPosition;
-		return std::vector<byte>(begin, end);
-	}
-	catch (const std::exception& ex)
-	{
-		throw ex;
-	}
+	if (offset < 0 || static_cast<size_t>(offset) > this->length || size > this->length - offset)
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+}
+
+auto BufferFile::Own() -> void
+{
+	// Copy-on-write for borrowed and shared data
+	if (this->view == this->data.data() && this->borrowed == nullptr)
+		return;
+	this->data.assign(this->view, this->view + this->length);
+	this->borrowed.reset();
+	this->view = this->data.data();
+	Contiguous(this->view, this->length);
 }
@@ -0,0 +1,38 @@
+#include "../Headers/ExportIndex.h"
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+ExportIndex::ExportIndex(ImageExportDirectory& exportDirectory) : exports(exportDirectory.GetExportFunctions()),
+	exportNames(exportDirectory.GetExportNames()), base(exportDirectory.Base())
+{
+	this->names.reserve(this->exportNames.size());
+	for (auto& exportName : this->exportNames)
+	{
+		if (!exportName.first.empty() && exportName.second < this->exports.size())
+			this->names.emplace(exportName.first, exportName.second);
+	}
+}
+
+auto ExportIndex::Find(const std::string_view& name) const -> const ExportFunction*
+{
+	auto found = this->names.find(name);
+	return found == this->names.end() ? nullptr : &this->exports[found->second];
+}
+
+auto ExportIndex::Find(const unsigned short& ordinal) const -> const ExportFunction*
+{
+	if (ordinal < this->base || ordinal - this->base >= this->exports.size())
+		return nullptr;
+
+	auto& exportFunction = this->exports[ordinal - this->base];
+	return exportFunction.Address == 0 ? nullptr : &exportFunction;
+}
+
+auto ExportIndex::Exports() const -> const std::vector<ExportFunction>&
+{
+	return this->exports;
+}
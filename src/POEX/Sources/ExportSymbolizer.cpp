@@ -0,0 +1,64 @@
+#include "../Headers/ExportSymbolizer.h"
+#include <algorithm>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+ExportSymbolizer::ExportSymbolizer(ImageExportDirectory& exportDirectory)
+{
+	try
+	{
+		auto exportFunctions = exportDirectory.GetExportFunctions();
+		this->exports.reserve(exportFunctions.size());
+		for (auto& exportFunction : exportFunctions)
+		{
+			// Forwarders don't point to code of this module, and null entries are ordinal gaps.
+			if (exportFunction.Address == 0 || exportDirectory.IsForwardedExport(exportFunction.Address))
+				continue;
+			this->exports.push_back(std::move(exportFunction));
+		}
+
+		std::sort(this->exports.begin(), this->exports.end(), [](const ExportFunction& first, const ExportFunction& second)
+			{
+				if (first.Address != second.Address)
+					return first.Address < second.Address;
+				if (first.Name.empty() != second.Name.empty())
+					return !first.Name.empty();
+				return first.Ordinal < second.Ordinal;
+			});
+
+		// One entry per distinct RVA, pointing to the preferred export of that RVA.
+		for (unsigned int i = 0; i < this->exports.size(); i++)
+		{
+			if (!this->addresses.empty() && this->addresses.back() == this->exports[i].Address)
+				continue;
+			this->addresses.push_back(this->exports[i].Address);
+			this->firsts.push_back(i);
+		}
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ExportSymbolizer::Symbolize(const unsigned int& virtualAddress) const -> std::optional<ExportSymbol>
+{
+	auto next = std::upper_bound(this->addresses.begin(), this->addresses.end(), virtualAddress);
+	if (next == this->addresses.begin())
+		return std::nullopt;
+
+	auto index = static_cast<size_t>(std::distance(this->addresses.begin(), next)) - 1;
+	ExportSymbol symbol;
+	symbol.Function = &this->exports[this->firsts[index]];
+	symbol.Displacement = virtualAddress - this->addresses[index];
+	return symbol;
+}
+
+auto ExportSymbolizer::Exports() const -> const std::vector<ExportFunction>&
+{
+	return this->exports;
+}
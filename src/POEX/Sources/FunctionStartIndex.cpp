@@ -0,0 +1,88 @@
+#include "../Headers/FunctionStartIndex.h"
+#include <algorithm>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+FunctionStartIndex::FunctionStartIndex(const PeModel& model)
+{
+	try
+	{
+		auto add = [this](const unsigned int& virtualAddress, const FunctionSource& source) {
+			FunctionStart start;
+			start.VirtualAddress = virtualAddress;
+			start.Sources = static_cast<unsigned char>(source);
+			this->starts.push_back(start);
+		};
+
+		// Other machines store RUNTIME_FUNCTION differently.
+		if (model.Machine() == static_cast<unsigned short>(MachineType::Amd64))
+		{
+			this->starts.reserve(model.RuntimeFunctions().size() + model.Exports().size() + model.TlsCallbacks().size() + 1);
+			for (const auto& function : model.RuntimeFunctions())
+				add(function.BeginAddress, FunctionSource::ExceptionDirectory);
+		}
+
+		// Exports can be data, only the ones in executable sections are kept.
+		auto isCode = [&model](const unsigned int& virtualAddress) {
+			for (const auto& section : model.Sections())
+				if ((section.Characteristics & static_cast<unsigned int>(SectionFlag::MemExecute)) != 0 &&
+					virtualAddress >= section.VirtualAddress &&
+					virtualAddress - section.VirtualAddress < std::max(section.VirtualSize, section.SizeOfRawData))
+					return true;
+			return false;
+		};
+		for (const auto& function : model.Exports())
+			if (function.ForwardedName.empty() && isCode(function.Address))
+				add(function.Address, FunctionSource::Export);
+
+		for (const auto& callback : model.TlsCallbacks())
+			if (callback >= model.ImageBase() && callback - model.ImageBase() <= 0xFFFFFFFF)
+				add(static_cast<unsigned int>(callback - model.ImageBase()), FunctionSource::TlsCallback);
+
+		if (model.AddressOfEntryPoint() != 0)
+			add(model.AddressOfEntryPoint(), FunctionSource::EntryPoint);
+
+		// Sort once, then merge the sources of duplicates into the first of them.
+		std::sort(this->starts.begin(), this->starts.end(), [](const FunctionStart& first, const FunctionStart& second) {
+			return first.VirtualAddress < second.VirtualAddress;
+		});
+		size_t count = 0;
+		for (size_t i = 0; i < this->starts.size(); i++)
+		{
+			if (count != 0 && this->starts[count - 1].VirtualAddress == this->starts[i].VirtualAddress)
+				this->starts[count - 1].Sources |= this->starts[i].Sources;
+			else
+				this->starts[count++] = this->starts[i];
+		}
+		this->starts.resize(count);
+		this->starts.shrink_to_fit();
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto FunctionStartIndex::Find(const unsigned int& virtualAddress) const -> const FunctionStart*
+{
+	auto it = std::lower_bound(this->starts.begin(), this->starts.end(), virtualAddress,
+		[](const FunctionStart& start, const unsigned int& value) { return start.VirtualAddress < value; });
+	return it != this->starts.end() && it->VirtualAddress == virtualAddress ? &*it : nullptr;
+}
+
+auto FunctionStartIndex::Range(const unsigned int& first, const unsigned int& last) const -> std::pair<Iterator, Iterator>
+{
+	auto byAddress = [](const FunctionStart& start, const unsigned int& value) { return start.VirtualAddress < value; };
+	auto begin = std::lower_bound(this->starts.begin(), this->starts.end(), first, byAddress);
+	auto end = last <= first ? begin : std::lower_bound(begin, this->starts.end(), last, byAddress);
+	return std::make_pair(begin, end);
+}
+
+auto FunctionStartIndex::Starts() const -> const std::vector<FunctionStart>&
+{
+	return this->starts;
+}
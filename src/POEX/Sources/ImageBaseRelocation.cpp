@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageBaseRelocation::ImageBaseRelocation(const std::shared_ptr<BufferFile>& bFile, 
+ImageBaseRelocation::ImageBaseRelocation(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset, const unsigned int& relocationSize) : 
 	bFile(bFile), offset(offset), relocationSize(relocationSize)
 {
@@ -19,9 +19,9 @@ ImageBaseRelocation::ImageBaseRelocation(const std::shared_ptr<BufferFile>& bFil
 		if (SizeOfBlock() < 8)
 			THROW_OUT_OF_RANGE("SizeOfBlock cannot be smaller than 8.");
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -29,11 +29,11 @@ auto ImageBaseRelocation::VirtualAddress() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset);
+		return this->bFile->Read<unsigned int>(this->offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -43,9 +43,9 @@ auto ImageBaseRelocation::VirtualAddress(const unsigned int& va) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset, va);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -53,11 +53,11 @@ auto ImageBaseRelocation::SizeOfBlock() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -67,9 +67,9 @@ auto ImageBaseRelocation::SizeOfBlock(const unsigned int& len) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, len);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -77,19 +77,65 @@ auto ImageBaseRelocation::TypeOffsets() -> std::vector<std::unique_ptr<TypeOffse
 {
 	try
 	{
+		// The whole block is read at once, each entry only keeps its word.
+		auto sizeOfBlock = SizeOfBlock();
+		auto values = this->bFile->ReadArray<unsigned short>(this->offset + 8, sizeOfBlock < 8 ? 0 : (sizeOfBlock - 8) / 2);
 		std::vector<std::unique_ptr<TypeOffset>> typeOffsets;
-		for (unsigned int i = 0; i < (SizeOfBlock() - 8) / 2; i++)
-			typeOffsets.push_back(std::make_unique<TypeOffset>(this->bFile, this->offset + 8 + i * 2));
+		typeOffsets.reserve(values.size());
+		for (auto value : values)
+			typeOffsets.push_back(std::make_unique<TypeOffset>(value));
 		return typeOffsets;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-TypeOffset::TypeOffset(const std::shared_ptr<BufferFile>& bFile, const long& offset) :
-	bFile(bFile), offset(offset)
+auto ImageBaseRelocation::Relocations() const -> std::vector<RelocationEntry>
+{
+	try
+	{
+		std::vector<RelocationEntry> relocations;
+		Relocations(relocations);
+		return relocations;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ImageBaseRelocation::Relocations(std::vector<RelocationEntry>& relocations) const -> void
+{
+	try
+	{
+		auto virtualAddress = VirtualAddress();
+		auto sizeOfBlock = SizeOfBlock();
+		auto values = this->bFile->ReadArray<unsigned short>(this->offset + 8, sizeOfBlock < 8 ? 0 : (sizeOfBlock - 8) / 2);
+		for (auto value : values)
+		{
+			// IMAGE_REL_BASED_ABSOLUTE only pads the block
+			if ((value >> 0x000C) == IMAGE_REL_BASED_ABSOLUTE)
+				continue;
+			RelocationEntry relocation;
+			relocation.VirtualAddress = virtualAddress + (value & 0x0FFF);
+			relocation.Type = static_cast<unsigned short>(value >> 0x000C);
+			relocations.push_back(relocation);
+		}
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+TypeOffset::TypeOffset(const std::shared_ptr<IRaw>& bFile, const long& offset) :
+	value(bFile->Read<unsigned short>(offset))
+{
+}
+
+TypeOffset::TypeOffset(const unsigned short& value) : value(value)
 {
 }
 
@@ -97,26 +143,29 @@ auto TypeOffset::Type() const -> std::string
 {
 	try
 	{
-		auto to = this->bFile->ReadUnsignedShort(offset);
-		auto type = (byte)(to >> 0x000C);
+		auto type = (byte)(this->value >> 0x000C);
 		return ParseType(type);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
+auto TypeOffset::TypeValue() const -> unsigned short
+{
+	return static_cast<unsigned short>(this->value >> 0x000C);
+}
+
 auto TypeOffset::Offset() const -> unsigned short
 {
 	try
 	{
-		auto to = this->bFile->ReadUnsignedShort(offset);
-		return (unsigned short)(to & 0x0FFF);
+		return (unsigned short)(this->value & 0x0FFF);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
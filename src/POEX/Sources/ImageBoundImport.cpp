@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageBoundImport::ImageBoundImport(const std::shared_ptr<BufferFile>& bFile, const long& offset) 
+ImageBoundImport::ImageBoundImport(const std::shared_ptr<IRaw>& bFile, const long& offset) 
 	: bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -17,11 +17,11 @@ auto ImageBoundImport::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0000);
+		return this->bFile->Read<unsigned int>(offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -31,9 +31,9 @@ auto ImageBoundImport::TimeDateStamp(const unsigned int& time) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, time);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -41,11 +41,11 @@ auto ImageBoundImport::OffsetModuleName() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x0004);
+		return this->bFile->Read<unsigned short>(offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -55,9 +55,9 @@ auto ImageBoundImport::OffsetModuleName(const unsigned short& offs) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, offs);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,11 +65,11 @@ auto ImageBoundImport::NumberOfModuleForwarderRefs() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x0006);
+		return this->bFile->Read<unsigned short>(offset + 0x0006);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -79,8 +79,8 @@ auto ImageBoundImport::NumberOfModuleForwarderRefs(const unsigned short& refs) -
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0006, refs);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
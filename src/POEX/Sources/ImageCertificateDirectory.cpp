@@ -7,7 +7,7 @@
 */
 
 
-ImageCertificateDirectory::ImageCertificateDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset)
+ImageCertificateDirectory::ImageCertificateDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset)
 	: bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -18,11 +18,11 @@ auto ImageCertificateDirectory::DwLength() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -32,9 +32,9 @@ auto ImageCertificateDirectory::DwLength(const unsigned int& length) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, length);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -42,11 +42,11 @@ auto ImageCertificateDirectory::WRevision() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0004);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -56,9 +56,9 @@ auto ImageCertificateDirectory::WRevision(const unsigned short& revision) -> voi
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0004, revision);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -66,11 +66,11 @@ auto ImageCertificateDirectory::WCertificateType() const -> WinCertificateType
 {
 	try
 	{
-		return static_cast<WinCertificateType>(this->bFile->ReadUnsignedShort(this->offset + 0x0006));
+		return static_cast<WinCertificateType>(this->bFile->Read<unsigned short>(this->offset + 0x0006));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -80,9 +80,9 @@ auto ImageCertificateDirectory::WCertificateType(const WinCertificateType& type)
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0006, static_cast<unsigned short>(type));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -90,13 +90,14 @@ auto ImageCertificateDirectory::BCertificate() const -> std::vector<byte>
 {
 	try
 	{
-		if (this->offset + 0x8 > bFile->Length() || this->offset + DwLength() > bFile->Length())
+		auto offset = static_cast<size_t>(this->offset);
+		if (offset + 0x8 > bFile->Length() || offset + DwLength() > bFile->Length())
 			THROW_OUT_OF_RANGE("BCertificate not in PE file range.");
 
 		return this->bFile->SubArray(this->offset + 0x0008, DwLength() - 8);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
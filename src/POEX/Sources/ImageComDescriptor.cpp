@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageComDescriptor::ImageComDescriptor(const std::shared_ptr<BufferFile>& bFile, const long& offset) :
+ImageComDescriptor::ImageComDescriptor(const std::shared_ptr<IRaw>& bFile, const long& offset) :
 	bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -41,9 +41,9 @@ auto ImageComDescriptor::ResolveComFlags(const ComFlagsType& comFlags) -> std::v
 
 		return flags;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -51,11 +51,11 @@ auto ImageComDescriptor::Cb() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,9 +65,9 @@ auto ImageComDescriptor::Cb(const unsigned int& size) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, size);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -75,11 +75,11 @@ auto ImageComDescriptor::MajorRuntimeVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0004);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -89,9 +89,9 @@ auto ImageComDescriptor::MajorRuntimeVersion(const unsigned short& version) -> v
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0004, version);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -99,11 +99,11 @@ auto ImageComDescriptor::MinorRuntimeVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0006);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0006);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -113,9 +113,9 @@ auto ImageComDescriptor::MinorRuntimeVersion(const unsigned short& version) -> v
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0006, version);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -127,9 +127,9 @@ auto ImageComDescriptor::MetaData() -> std::shared_ptr<ImageDataDirectory>
 			this->_metaData :
 			this->_metaData = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -137,11 +137,11 @@ auto ImageComDescriptor::Flags() const -> ComFlagsType
 {
 	try
 	{
-		return static_cast<ComFlagsType>(this->bFile->ReadUnsignedInt(this->offset + 0x0010));
+		return static_cast<ComFlagsType>(this->bFile->Read<unsigned int>(this->offset + 0x0010));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -151,9 +151,9 @@ auto ImageComDescriptor::FlagsResolved() const -> std::vector<std::string>
 	{
 		return ResolveComFlags(Flags());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -161,11 +161,11 @@ auto ImageComDescriptor::EntryPointToken() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -175,9 +175,9 @@ auto ImageComDescriptor::EntryPointToken(const unsigned int& entryPoint) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0014, entryPoint);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -187,9 +187,9 @@ auto ImageComDescriptor::EntryPointRva() const -> unsigned int
 	{
 		return EntryPointToken();
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -199,9 +199,9 @@ auto ImageComDescriptor::EntryPointRva(const unsigned int& entryPoint) -> void
 	{
 		EntryPointToken(entryPoint);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -213,9 +213,9 @@ auto ImageComDescriptor::Resources() -> std::shared_ptr<ImageDataDirectory>
 			this->_resources : 
 			this->_resources = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -227,9 +227,9 @@ auto ImageComDescriptor::StrongNameSignature() -> std::shared_ptr<ImageDataDirec
 			this->_strongSignatureNames :
 			this->_strongSignatureNames = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0020);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -241,9 +241,9 @@ auto ImageComDescriptor::CodeManagerTable() -> std::shared_ptr<ImageDataDirector
 			this->_codeManagerTable :
 			this->_codeManagerTable = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0028);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -255,9 +255,9 @@ auto ImageComDescriptor::VTableFixups() -> std::shared_ptr<ImageDataDirectory>
 			this->_vTableFixups :
 			this->_vTableFixups = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0030);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -269,9 +269,9 @@ auto ImageComDescriptor::ExportAddressTableJumps() -> std::shared_ptr<ImageDataD
 			this->_exportAddressTableJumps :
 			this->_exportAddressTableJumps = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0038);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -283,8 +283,8 @@ auto ImageComDescriptor::ManagedNativeHeader() -> std::shared_ptr<ImageDataDirec
 			this->_managedNativeHeader :
 			this->_managedNativeHeader = std::make_shared<ImageDataDirectory>(this->bFile, this->offset + 0x0040);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageDataDirectory::ImageDataDirectory(const std::shared_ptr<BufferFile>& bFile,
+ImageDataDirectory::ImageDataDirectory(const std::shared_ptr<IRaw>& bFile,
 	const long& offset,
 	const DataDirectoryType& dataDirectoryType) : bFile(bFile), offset(offset), dataDirectoryType(dataDirectoryType)
 {
@@ -14,7 +14,7 @@ ImageDataDirectory::ImageDataDirectory(const std::shared_ptr<BufferFile>& bFile,
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
 }
 
-ImageDataDirectory::ImageDataDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset) :
+ImageDataDirectory::ImageDataDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset) :
 	bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -25,11 +25,11 @@ auto ImageDataDirectory::VirtualAddress() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -39,9 +39,9 @@ auto ImageDataDirectory::VirtualAddress(const unsigned int& virtualAddress) -> v
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, virtualAddress);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -49,11 +49,11 @@ auto ImageDataDirectory::Size() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -63,8 +63,8 @@ auto ImageDataDirectory::Size(const unsigned int& size) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, size);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageDebugDirectory::ImageDebugDirectory(const std::shared_ptr<BufferFile>& bFile, 
+ImageDebugDirectory::ImageDebugDirectory(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset) : bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -17,11 +17,11 @@ auto ImageDebugDirectory::Characteristics() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -31,9 +31,9 @@ auto ImageDebugDirectory::Characteristics(const unsigned int& characteristics) -
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, characteristics);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -41,11 +41,11 @@ auto ImageDebugDirectory::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -55,9 +55,9 @@ auto ImageDebugDirectory::TimeDateStamp(const unsigned int& time) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, time);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,11 +65,11 @@ auto ImageDebugDirectory::MajorVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0008);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -79,9 +79,9 @@ auto ImageDebugDirectory::MajorVersion(const unsigned short& majorVersion) -> vo
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0008, majorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -89,11 +89,11 @@ auto ImageDebugDirectory::MinorVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x000A);
+		return this->bFile->Read<unsigned short>(this->offset + 0x000A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -103,9 +103,9 @@ auto ImageDebugDirectory::MinorVersion(const unsigned short& minorVersion) -> vo
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0008, minorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -113,11 +113,11 @@ auto ImageDebugDirectory::Type() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -127,9 +127,9 @@ auto ImageDebugDirectory::Type(const unsigned int& type) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, type);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -139,9 +139,9 @@ auto ImageDebugDirectory::DebugType() const -> DebugDirectoryType
 	{
 		return static_cast<DebugDirectoryType>(this->Type());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -151,9 +151,9 @@ auto ImageDebugDirectory::DebugType(const DebugDirectoryType& type) -> void
 	{
 		this->Type((unsigned int)type);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -161,11 +161,11 @@ auto ImageDebugDirectory::SizeOfData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -175,9 +175,9 @@ auto ImageDebugDirectory::SizeOfData(const unsigned int& length) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0010, length);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -185,11 +185,11 @@ auto ImageDebugDirectory::AddressOfRawData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -199,9 +199,9 @@ auto ImageDebugDirectory::AddressOfRawData(const unsigned int& offset) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0014, offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -209,11 +209,11 @@ auto ImageDebugDirectory::PointerToRawData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0018);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -223,9 +223,9 @@ auto ImageDebugDirectory::PointerToRawData(const unsigned int& offset) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0018, offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -238,9 +238,9 @@ auto ImageDebugDirectory::PdbInfo() const -> std::unique_ptr<CvInfoPdb70>
 
 		return std::make_unique<CvInfoPdb70>(this->bFile, PointerToRawData());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -252,15 +252,15 @@ auto ImageDebugDirectory::ExtendedDllCharacteristics() const -> ExtendedDllChara
 			return ExtendedDllCharacteristicsType::NullType;
 
 		return static_cast<ExtendedDllCharacteristicsType>(
-			this->bFile->ReadUnsignedInt(this->PointerToRawData()));
+			this->bFile->Read<unsigned int>(this->PointerToRawData()));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-CvInfoPdb70::CvInfoPdb70(const std::shared_ptr<BufferFile>& bFile, const long& offset) :
+CvInfoPdb70::CvInfoPdb70(const std::shared_ptr<IRaw>& bFile, const long& offset) :
 	bFile(bFile), offset(offset)
 {
 }
@@ -269,11 +269,11 @@ auto CvInfoPdb70::CvSignature() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -283,9 +283,9 @@ auto CvInfoPdb70::CvSignature(const unsigned int& cvSignature) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0000, cvSignature);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -295,12 +295,12 @@ auto CvInfoPdb70::Signature() const -> GUID
 	{
 		std::vector<byte> readed;
 		for (size_t i = 0; i < 16; i++)
-			readed.push_back(this->bFile->ReadByte(offset + 0x0004 + i));
+			readed.push_back(this->bFile->Read<byte>(offset + 0x0004 + i));
 		return *reinterpret_cast<GUID*>(&readed[0]);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -308,16 +308,12 @@ auto CvInfoPdb70::Signature(const GUID& signature) -> void
 {
 	try
 	{
-		std::vector<byte> as;
-		as.push_back(signature.Data1);
-		as.push_back(signature.Data2);
-		as.push_back(signature.Data3);
-		as.push_back((byte)signature.Data4);
-		//this->bFile->WriteBytes(offset + 0x0004, as);
+		auto bytes = reinterpret_cast<const byte*>(&signature);
+		this->bFile->WriteBytes(this->offset + 0x0004, std::vector<byte>(bytes, bytes + sizeof(GUID)));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -325,11 +321,11 @@ auto CvInfoPdb70::Age() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -339,9 +335,9 @@ auto CvInfoPdb70::Age(const unsigned int& age) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0014, age);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -351,8 +347,8 @@ auto CvInfoPdb70::PdbFileName() const -> std::string
 	{
 		return this->bFile->ReadAsciiString(offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
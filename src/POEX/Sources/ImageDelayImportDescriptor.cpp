@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageDelayImportDescriptor::ImageDelayImportDescriptor(const std::shared_ptr<BufferFile>& bFile, 
+ImageDelayImportDescriptor::ImageDelayImportDescriptor(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset) : bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -17,11 +17,11 @@ auto ImageDelayImportDescriptor::Attributes() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -31,9 +31,9 @@ auto ImageDelayImportDescriptor::Attributes(const unsigned int& off) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -41,11 +41,11 @@ auto ImageDelayImportDescriptor::DllNameRVA() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -55,9 +55,9 @@ auto ImageDelayImportDescriptor::DllNameRVA(const unsigned int& off) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,11 +65,11 @@ auto ImageDelayImportDescriptor::ModuleHandleRVA() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0008);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -79,9 +79,9 @@ auto ImageDelayImportDescriptor::ModuleHandleRVA(const unsigned int& off) -> voi
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0008, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -89,11 +89,11 @@ auto ImageDelayImportDescriptor::ImportAddressTableRVA() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -103,9 +103,9 @@ auto ImageDelayImportDescriptor::ImportAddressTableRVA(const unsigned int& off)
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -113,11 +113,11 @@ auto ImageDelayImportDescriptor::ImportNameTableRVA() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -127,9 +127,9 @@ auto ImageDelayImportDescriptor::ImportNameTableRVA(const unsigned int& off) ->
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0010, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -137,11 +137,11 @@ auto ImageDelayImportDescriptor::BoundImportAddressTableRVA() const -> unsigned
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -151,9 +151,9 @@ auto ImageDelayImportDescriptor::BoundImportAddressTableRVA(const unsigned int&
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0014, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -161,11 +161,11 @@ auto ImageDelayImportDescriptor::UnloadInformationTableRVA() const -> unsigned i
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0018);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -175,9 +175,9 @@ auto ImageDelayImportDescriptor::UnloadInformationTableRVA(const unsigned int& o
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0018, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -185,11 +185,11 @@ auto ImageDelayImportDescriptor::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x001C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x001C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -199,8 +199,8 @@ auto ImageDelayImportDescriptor::TimeDateStamp(const unsigned int& off) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x001C, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
@@ -6,10 +6,11 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageDosHeader::ImageDosHeader(const std::shared_ptr<BufferFile>& bFile, 
+ImageDosHeader::ImageDosHeader(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset) : bFile(bFile), offset(offset)
 {
-	if (WRONG_LONG(this->offset))
+	// The DOS header is at the start of the file, so offset 0 is valid here.
+	if (this->offset < 0)
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
 }
 
@@ -17,11 +18,11 @@ auto ImageDosHeader::E_magic() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0000);
+		return bFile->Read<unsigned short>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -31,9 +32,9 @@ auto ImageDosHeader::E_magic(const unsigned short& magic) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0000, magic);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -41,11 +42,11 @@ auto ImageDosHeader::E_cblp() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0002);
+		return bFile->Read<unsigned short>(this->offset + 0x0002);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -55,9 +56,9 @@ auto ImageDosHeader::E_cblp(const unsigned short& cblp) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0002, cblp);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -65,11 +66,11 @@ auto ImageDosHeader::E_cp() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0004);
+		return bFile->Read<unsigned short>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -79,9 +80,9 @@ auto ImageDosHeader::E_cp(const unsigned short& cp) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0004, cp);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -89,11 +90,11 @@ auto ImageDosHeader::E_crlc() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0006);
+		return bFile->Read<unsigned short>(this->offset + 0x0006);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -103,9 +104,9 @@ auto ImageDosHeader::E_crlc(const unsigned short& crlc) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0006, crlc);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -113,11 +114,11 @@ auto ImageDosHeader::E_cparhdr() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0008);
+		return bFile->Read<unsigned short>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -127,9 +128,9 @@ auto ImageDosHeader::E_cparhdr(const unsigned short& cparhdr) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0008, cparhdr);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -137,11 +138,11 @@ auto ImageDosHeader::E_minalloc() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x000A);
+		return bFile->Read<unsigned short>(this->offset + 0x000A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -151,9 +152,9 @@ auto ImageDosHeader::E_minalloc(const unsigned short& minalloc) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x000A, minalloc);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -161,11 +162,11 @@ auto ImageDosHeader::E_maxalloc() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x000C);
+		return bFile->Read<unsigned short>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -175,9 +176,9 @@ auto ImageDosHeader::E_maxalloc(const unsigned short& maxalloc) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x000C, maxalloc);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -185,11 +186,11 @@ auto ImageDosHeader::E_ss() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x000E);
+		return bFile->Read<unsigned short>(this->offset + 0x000E);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -199,9 +200,9 @@ auto ImageDosHeader::E_ss(const unsigned short& ss) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x000E, ss);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -209,11 +210,11 @@ auto ImageDosHeader::E_sp() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0010);
+		return bFile->Read<unsigned short>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -223,9 +224,9 @@ auto ImageDosHeader::E_sp(const unsigned short& sp) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0010, sp);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -233,11 +234,11 @@ auto ImageDosHeader::E_csum() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0012);
+		return bFile->Read<unsigned short>(this->offset + 0x0012);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -247,9 +248,9 @@ auto ImageDosHeader::E_csum(const unsigned short& csum) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0012, csum);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -257,11 +258,11 @@ auto ImageDosHeader::E_ip() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0014);
+		return bFile->Read<unsigned short>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -271,9 +272,9 @@ auto ImageDosHeader::E_ip(const unsigned short& ip) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0014, ip);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -281,11 +282,11 @@ auto ImageDosHeader::E_cs() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0016);
+		return bFile->Read<unsigned short>(this->offset + 0x0016);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -295,9 +296,9 @@ auto ImageDosHeader::E_cs(const unsigned short& cs) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0016, cs);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -305,11 +306,11 @@ auto ImageDosHeader::E_lfarlc() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0018);
+		return bFile->Read<unsigned short>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -319,9 +320,9 @@ auto ImageDosHeader::E_lfarlc(const unsigned short& lfarlc) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0018, lfarlc);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -329,11 +330,11 @@ auto ImageDosHeader::E_ovno() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x001A);
+		return bFile->Read<unsigned short>(this->offset + 0x001A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -343,9 +344,9 @@ auto ImageDosHeader::E_ovno(const unsigned short& evno) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x001A, evno);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -354,16 +355,16 @@ auto ImageDosHeader::E_res() const -> std::vector<unsigned short>
 	try
 	{
 		auto data = std::vector<unsigned short>{};
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x001C));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x001E));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0020));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0022));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x001C));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x001E));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0020));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0022));
 
 		return data;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -376,9 +377,9 @@ auto ImageDosHeader::E_res(const std::vector<unsigned short>& res) -> void
 		bFile->WriteUnsignedShort(offset + 0x0020, res[2]);
 		bFile->WriteUnsignedShort(offset + 0x0022, res[3]);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -386,11 +387,11 @@ auto ImageDosHeader::E_oemid() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0024);
+		return bFile->Read<unsigned short>(this->offset + 0x0024);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -400,9 +401,9 @@ auto ImageDosHeader::E_oemid(const unsigned short& oemid) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0024, oemid);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -410,11 +411,11 @@ auto ImageDosHeader::E_oeminfo() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0026);
+		return bFile->Read<unsigned short>(this->offset + 0x0026);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -424,9 +425,9 @@ auto ImageDosHeader::E_oeminfo(const unsigned short& oeminfo) -> void
 	{
 		bFile->WriteUnsignedShort(offset + 0x0026, oeminfo);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -435,22 +436,22 @@ auto ImageDosHeader::E_res2() const -> std::vector<unsigned short>
 	try
 	{
 		auto data = std::vector<unsigned short>{};
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0028));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x002A));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x002C));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x002E));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0030));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0032));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0034));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0036));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x0038));
-		data.push_back(bFile->ReadUnsignedShort(this->offset + 0x003A));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0028));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x002A));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x002C));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x002E));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0030));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0032));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0034));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0036));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x0038));
+		data.push_back(bFile->Read<unsigned short>(this->offset + 0x003A));
 
 		return data;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -469,9 +470,9 @@ auto ImageDosHeader::E_res2(const std::vector<unsigned short>& res) -> void
 		bFile->WriteUnsignedShort(offset + 0x0038, res[8]);
 		bFile->WriteUnsignedShort(offset + 0x003A, res[9]);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -479,11 +480,11 @@ auto ImageDosHeader::E_lfanew() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x003C);
+		return bFile->Read<unsigned int>(this->offset + 0x003C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -493,8 +494,20 @@ auto ImageDosHeader::E_lfanew(const unsigned int& elfanew) -> void
 	{
 		bFile->WriteUnsignedInt(offset + 0x003C, elfanew);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
+	}
+}
+
+auto ImageDosHeader::Snapshot() const -> DosHeaderSnapshot
+{
+	try
+	{
+		return this->bFile->Read<DosHeaderSnapshot>(this->offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
 	}
 }
@@ -1,5 +1,4 @@
 #include "../Headers/ImageExceptionDirectory.h"
-#include "../Headers/Utils.h"
 
 /**
 * Portable Executable (POEX) Project
@@ -7,10 +6,10 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageExceptionDirectory::ImageExceptionDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-	const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, const bool& is32Bit,
+ImageExceptionDirectory::ImageExceptionDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
+	const std::shared_ptr<const SectionIndex>& sectionIndex, const bool& is32Bit,
 	const unsigned int& directorySize) :
-	bFile(bFile), offset(offset), imageSectionHeaders(imageSectionHeaders), 
+	bFile(bFile), sectionIndex(sectionIndex), offset(offset), 
 	is32Bit(is32Bit), directorySize(directorySize)
 {
 	if (WRONG_LONG(this->offset))
@@ -27,96 +26,110 @@ auto ImageExceptionDirectory::GetExceptionDirectories() -> std::vector<std::uniq
 		const int sizeOfRuntimeFunction = 0xC;
 		auto numberOfFunction = directorySize / sizeOfRuntimeFunction;
 		std::vector<std::unique_ptr<ExceptionTable>> exceptionTables;
+		exceptionTables.reserve(numberOfFunction);
 		for (size_t i = 0; i < numberOfFunction; i++)
 		{
 			exceptionTables.push_back(std::make_unique<ExceptionTable>(this->bFile, 
-				(long)(this->offset + i * sizeOfRuntimeFunction), this->imageSectionHeaders));
+				(long)(this->offset + i * sizeOfRuntimeFunction)));
 		}
 
 		return exceptionTables;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-ExceptionTable::ExceptionTable(const std::shared_ptr<BufferFile>& bFile, const long& offset,
-	const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders) :
-	bFile(bFile), offset(offset), imageSectionHeaders(imageSectionHeaders)
+auto ImageExceptionDirectory::GetRuntimeFunctions() -> std::vector<RuntimeFunction>
+{
+	try
+	{
+		if (is32Bit || offset == 0)
+			return std::vector<RuntimeFunction>();
+		return this->bFile->ReadArray<RuntimeFunction>(this->offset, directorySize / sizeof(RuntimeFunction));
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+ExceptionTable::ExceptionTable(const std::shared_ptr<IRaw>& bFile, const long& offset) :
+	bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
 }
 
-auto ExceptionTable::BeginAddress() const -> unsigned long
+auto ExceptionTable::BeginAddress() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedLong(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ExceptionTable::BeginAddress(const unsigned long& offset) -> void
+auto ExceptionTable::BeginAddress(const unsigned int& offset) -> void
 {
 	try
 	{
-		this->bFile->WriteUnsignedLong(this->offset + 0x0000, offset);
+		this->bFile->WriteUnsignedInt(this->offset + 0x0000, offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ExceptionTable::EndAddress() const -> unsigned long
+auto ExceptionTable::EndAddress() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedLong(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ExceptionTable::EndAddress(const unsigned long& offset) -> void
+auto ExceptionTable::EndAddress(const unsigned int& offset) -> void
 {
 	try
 	{
-		this->bFile->WriteUnsignedLong(this->offset + 0x0004, offset);
+		this->bFile->WriteUnsignedInt(this->offset + 0x0004, offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ExceptionTable::UnwInfo() const -> unsigned long
+auto ExceptionTable::UnwInfo() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedLong(this->offset + 0x0008);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ExceptionTable::UnwInfo(const unsigned long& pointer) -> void
+auto ExceptionTable::UnwInfo(const unsigned int& pointer) -> void
 {
 	try
 	{
-		this->bFile->WriteUnsignedLong(this->offset + 0x0008, pointer);
+		this->bFile->WriteUnsignedInt(this->offset + 0x0008, pointer);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
\ No newline at end of file
@@ -1,5 +1,4 @@
 #include "../Headers/ImageExportDirectory.h"
-#include "../Headers/Utils.h"
 
 /**
 * Portable Executable (POEX) Project
@@ -7,9 +6,9 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageExportDirectory::ImageExportDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-	const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, std::unique_ptr<ImageDataDirectory> imageDataDirectory) :
-	bFile(bFile), offset(offset), imageSectionHeaders(imageSectionHeaders), imageDataDirectory(std::move(imageDataDirectory))
+ImageExportDirectory::ImageExportDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
+	const std::shared_ptr<const SectionIndex>& sectionIndex, std::unique_ptr<ImageDataDirectory> imageDataDirectory) :
+	bFile(bFile), sectionIndex(sectionIndex), imageDataDirectory(std::move(imageDataDirectory)), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
@@ -19,11 +18,11 @@ auto ImageExportDirectory::Characteristics() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -33,9 +32,9 @@ auto ImageExportDirectory::Characteristics(const unsigned int& characteristics)
 	{
 		bFile->WriteUnsignedInt(offset + 0x0000, characteristics);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -43,11 +42,11 @@ auto ImageExportDirectory::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -57,9 +56,9 @@ auto ImageExportDirectory::TimeDateStamp(const unsigned int& timeDateStamp) -> v
 	{
 		bFile->WriteUnsignedInt(offset + 0x0004, timeDateStamp);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -67,11 +66,11 @@ auto ImageExportDirectory::MajorVersion() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x0008);
+		return bFile->Read<unsigned short>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -81,9 +80,9 @@ auto ImageExportDirectory::MajorVersion(const unsigned short& majorVersion) -> v
 	{
 		bFile->WriteUnsignedShort(offset + 0x0008, majorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -91,11 +90,11 @@ auto ImageExportDirectory::MinorVersion() const -> unsigned short
 {
 	try
 	{
-		return bFile->ReadUnsignedShort(this->offset + 0x000A);
+		return bFile->Read<unsigned short>(this->offset + 0x000A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -105,9 +104,9 @@ auto ImageExportDirectory::MinorVersion(const unsigned short& minorVersion) -> v
 	{
 		bFile->WriteUnsignedShort(offset + 0x000A, minorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -115,11 +114,11 @@ auto ImageExportDirectory::Name() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -129,9 +128,9 @@ auto ImageExportDirectory::Name(const unsigned int& name) -> void
 	{
 		bFile->WriteUnsignedInt(offset + 0x000C, name);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -139,11 +138,11 @@ auto ImageExportDirectory::Base() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -153,9 +152,9 @@ auto ImageExportDirectory::Base(const unsigned int& base) -> void
 	{
 		bFile->WriteUnsignedInt(offset + 0x0010, base);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -163,11 +162,11 @@ auto ImageExportDirectory::NumberOfFunctions() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -177,9 +176,9 @@ auto ImageExportDirectory::NumberOfFunctions(const unsigned int& numberOfFunctio
 	{
 		bFile->WriteUnsignedInt(offset + 0x0014, numberOfFunctions);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -187,11 +186,11 @@ auto ImageExportDirectory::NumberOfNames() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0018);
+		return bFile->Read<unsigned int>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -201,9 +200,9 @@ auto ImageExportDirectory::NumberOfNames(const unsigned int& numberOfNames) -> v
 	{
 		bFile->WriteUnsignedInt(offset + 0x0018, numberOfNames);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -211,11 +210,11 @@ auto ImageExportDirectory::AddressOfFunctions() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x001C);
+		return bFile->Read<unsigned int>(this->offset + 0x001C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -225,9 +224,9 @@ auto ImageExportDirectory::AddressOfFunctions(const unsigned int& addressOfFunct
 	{
 		bFile->WriteUnsignedInt(offset + 0x001C, addressOfFunctions);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -235,11 +234,11 @@ auto ImageExportDirectory::AddressOfNames() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0020);
+		return bFile->Read<unsigned int>(this->offset + 0x0020);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -249,9 +248,9 @@ auto ImageExportDirectory::AddressOfNames(const unsigned int& addressOfNames) ->
 	{
 		bFile->WriteUnsignedInt(offset + 0x0020, addressOfNames);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -259,11 +258,11 @@ auto ImageExportDirectory::AddressOfNameOrdinals() const -> unsigned int
 {
 	try
 	{
-		return bFile->ReadUnsignedInt(this->offset + 0x0024);
+		return bFile->Read<unsigned int>(this->offset + 0x0024);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -273,9 +272,9 @@ auto ImageExportDirectory::AddressOfNameOrdinals(const unsigned int& addressOfNa
 	{
 		bFile->WriteUnsignedInt(offset + 0x0024, addressOfNameOrdinals);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -286,60 +285,141 @@ auto ImageExportDirectory::GetExportFunctions() -> std::vector<ExportFunction>
 		if (imageDataDirectory == nullptr || this->AddressOfFunctions() == 0)
 			return std::vector<ExportFunction>();
 
-		auto expFuncs = std::vector<ExportFunction>();
-		auto funcOffsetPointer = Utils::RvaToOffset(this->AddressOfFunctions(), imageSectionHeaders);
-		auto ordOffset = this->NumberOfNames() == 0 ? 0 : Utils::RvaToOffset(this->AddressOfNameOrdinals(), imageSectionHeaders);
-		auto nameOffsetPointer = this->NumberOfNames() == 0 ? 0 : Utils::RvaToOffset(this->AddressOfNames(), imageSectionHeaders);
+		auto base = this->Base();
+		auto numberOfNames = this->NumberOfNames();
+		auto funcOffsetPointer = this->sectionIndex->RvaToOffset(this->AddressOfFunctions());
+		auto ordOffset = numberOfNames == 0 ? 0 : this->sectionIndex->RvaToOffset(this->AddressOfNameOrdinals());
+		auto nameOffsetPointer = numberOfNames == 0 ? 0 : this->sectionIndex->RvaToOffset(this->AddressOfNames());
 
-		for (unsigned int i = 0; i < this->NumberOfFunctions(); i++)
-		{
-			auto ordinal = this->Base() + i;
-			auto address = this->bFile->ReadUnsignedInt(funcOffsetPointer + sizeof(unsigned int) * i);
+		// Read the three tables at once instead of one element at a time.
+		auto addresses = this->bFile->ReadArray<unsigned int>(funcOffsetPointer, this->NumberOfFunctions());
+		auto names = this->bFile->ReadArray<unsigned int>(nameOffsetPointer, numberOfNames);
+		auto ordinals = this->bFile->ReadArray<unsigned short>(ordOffset, numberOfNames);
 
-			auto ef = ExportFunction(std::string(), address, static_cast<unsigned short>(ordinal));
-			expFuncs.push_back(ef);
-		}
+		auto expFuncs = std::vector<ExportFunction>();
+		expFuncs.reserve(addresses.size());
+		for (unsigned int i = 0; i < addresses.size(); i++)
+			expFuncs.push_back(ExportFunction(std::string(), addresses[i], static_cast<unsigned short>(base + i)));
 
-		for (unsigned int i = 0; i < this->NumberOfNames(); i++)
+		for (unsigned int i = 0; i < numberOfNames; i++)
 		{
-			auto namePtr = this->bFile->ReadUnsignedInt(nameOffsetPointer + sizeof(unsigned int) * i);
-			auto nameAdr = Utils::RvaToOffset(namePtr, imageSectionHeaders);
-			auto name = this->bFile->ReadAsciiString(nameAdr);
-			auto ordinalIndex = (unsigned int)this->bFile->ReadUnsignedShort(ordOffset + sizeof(unsigned short) * i);
-
-			auto expFunc = expFuncs.at(ordinalIndex);
+			auto nameAdr = this->sectionIndex->RvaToOffset(names[i]);
+			auto& expFunc = expFuncs.at(ordinals[i]);
+			expFunc.Name = this->bFile->ReadAsciiString(nameAdr);
 			if (IsForwardedExport(expFunc.Address))
 			{
-				auto forwardNameAdr = Utils::RvaToOffset(expFunc.Address, imageSectionHeaders);
-				auto forwardName = this->bFile->ReadAsciiString(forwardNameAdr);
+				auto forwardNameAdr = this->sectionIndex->RvaToOffset(expFunc.Address);
+				expFunc.ForwardedName = this->bFile->ReadAsciiString(forwardNameAdr);
+			}
+		}
+		return expFuncs;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
 
+auto ImageExportDirectory::GetExportNames() -> std::vector<std::pair<std::string, unsigned short>>
+{
+	try
+	{
+		auto numberOfNames = this->NumberOfNames();
+		if (imageDataDirectory == nullptr || this->AddressOfFunctions() == 0 || numberOfNames == 0)
+			return std::vector<std::pair<std::string, unsigned short>>();
 
-				auto ef = ExportFunction(name, expFunc.Address, expFunc.Ordinal, forwardName);
-				expFuncs.at(ordinalIndex) = ef;
-			}
+		auto names = this->bFile->ReadArray<unsigned int>(this->sectionIndex->RvaToOffset(this->AddressOfNames()), numberOfNames);
+		auto ordinals = this->bFile->ReadArray<unsigned short>(this->sectionIndex->RvaToOffset(this->AddressOfNameOrdinals()), numberOfNames);
+
+		auto exportNames = std::vector<std::pair<std::string, unsigned short>>();
+		exportNames.reserve(numberOfNames);
+		for (unsigned int i = 0; i < numberOfNames; i++)
+			exportNames.emplace_back(this->bFile->ReadAsciiString(this->sectionIndex->RvaToOffset(names[i])), ordinals[i]);
+		return exportNames;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ImageExportDirectory::FindExport(const std::string_view& name) const -> std::optional<ExportFunction>
+{
+	try
+	{
+		auto numberOfNames = this->NumberOfNames();
+		if (imageDataDirectory == nullptr || this->AddressOfFunctions() == 0 || numberOfNames == 0)
+			return std::nullopt;
+
+		auto nameOffsetPointer = this->sectionIndex->RvaToOffset(this->AddressOfNames());
+		auto ordOffset = this->sectionIndex->RvaToOffset(this->AddressOfNameOrdinals());
+
+		// The name pointer table is sorted lexically (the loader relies on it), so compare like strcmp.
+		std::string storage;
+		unsigned int low = 0, high = numberOfNames;
+		while (low < high)
+		{
+			auto middle = low + (high - low) / 2;
+			auto nameAdr = this->sectionIndex->RvaToOffset(
+				this->bFile->Read<unsigned int>(nameOffsetPointer + static_cast<long>(middle) * 4));
+			auto compare = this->bFile->ViewAsciiString(nameAdr, storage).compare(name);
+			if (compare < 0)
+				low = middle + 1;
+			else if (compare > 0)
+				high = middle;
 			else
-			{
-				auto ef = ExportFunction(name, expFunc.Address, expFunc.Ordinal);
-				expFuncs.at(ordinalIndex) = ef;
-			}
+				return ExportAt(this->bFile->Read<unsigned short>(ordOffset + static_cast<long>(middle) * 2), std::string(name));
 		}
-		return expFuncs;
+		return std::nullopt;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-auto ImageExportDirectory::IsForwardedExport(const unsigned int& address) -> bool
+auto ImageExportDirectory::FindExport(const unsigned short& ordinal) const -> std::optional<ExportFunction>
+{
+	try
+	{
+		if (imageDataDirectory == nullptr || this->AddressOfFunctions() == 0 || ordinal < this->Base())
+			return std::nullopt;
+
+		return ExportAt(ordinal - this->Base(), std::string());
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ImageExportDirectory::ExportAt(const unsigned int& index, const std::string& name) const -> std::optional<ExportFunction>
+{
+	if (index >= this->NumberOfFunctions())
+		return std::nullopt;
+
+	auto funcOffsetPointer = this->sectionIndex->RvaToOffset(this->AddressOfFunctions());
+	auto address = this->bFile->Read<unsigned int>(funcOffsetPointer + static_cast<long>(index) * 4);
+
+	// A null entry is a gap in the ordinals.
+	if (address == 0)
+		return std::nullopt;
+
+	auto expFunc = ExportFunction(name, address, static_cast<unsigned short>(this->Base() + index));
+	if (IsForwardedExport(address))
+		expFunc.ForwardedName = this->bFile->ReadAsciiString(this->sectionIndex->RvaToOffset(address));
+	return expFunc;
+}
+
+auto ImageExportDirectory::IsForwardedExport(const unsigned int& address) const -> bool
 {
 	try
 	{
 		return imageDataDirectory->VirtualAddress() <= address &&
 			address < imageDataDirectory->VirtualAddress() + imageDataDirectory->Size();
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
\ No newline at end of file
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageFileHeader::ImageFileHeader(const std::shared_ptr<BufferFile>& bFile, 
+ImageFileHeader::ImageFileHeader(const std::shared_ptr<IRaw>& bFile, 
     const long& offset) : bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(offset))
@@ -66,9 +66,9 @@ auto ImageFileHeader::ToString(MachineType machine) -> std::string
             return "NOT FOUND MACHINE TYPE";
         }
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -96,9 +96,9 @@ auto ImageFileHeader::ToString(FileCharacteristicsType fileCharacteristicsType)
         default: return "NOT FOUND File Characteristics Type";
         }
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -106,11 +106,11 @@ auto ImageFileHeader::Machine() const -> MachineType
 {
     try
     {
-        return static_cast<MachineType>(this->bFile->ReadUnsignedShort(this->offset + 0x0000));
+        return static_cast<MachineType>(this->bFile->Read<unsigned short>(this->offset + 0x0000));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -120,9 +120,9 @@ auto ImageFileHeader::Machine(MachineType machine) -> void
     {
         this->bFile->WriteUnsignedShort(this->offset + 0x0000, (unsigned short)machine);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -130,11 +130,11 @@ auto ImageFileHeader::NumberOfSection() const -> unsigned short
 {
     try
     {
-        return this->bFile->ReadUnsignedShort(this->offset + 0x0002);
+        return this->bFile->Read<unsigned short>(this->offset + 0x0002);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -144,9 +144,9 @@ auto ImageFileHeader::NumberOfSection(const unsigned short& numberOfSection) ->
     {
         this->bFile->WriteUnsignedShort(this->offset + 0x0002, numberOfSection);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -154,11 +154,11 @@ auto ImageFileHeader::TimeDateStamp() const -> unsigned int
 {
     try
     {
-        return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+        return this->bFile->Read<unsigned int>(this->offset + 0x0004);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -168,9 +168,9 @@ auto ImageFileHeader::TimeDateStamp(const unsigned int& timeDateStamp) -> void
     {
         this->bFile->WriteUnsignedInt(this->offset + 0x0004, timeDateStamp);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -178,11 +178,11 @@ auto ImageFileHeader::PointerToSymbolTable() const -> unsigned int
 {
     try
     {
-        return this->bFile->ReadUnsignedShort(this->offset + 0x0008);
+        return this->bFile->Read<unsigned short>(this->offset + 0x0008);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -192,9 +192,9 @@ auto ImageFileHeader::PointerToSymbolTable(const unsigned int& pointerToSymbolTa
     {
         this->bFile->WriteUnsignedInt(this->offset + 0x0008, pointerToSymbolTable);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -202,11 +202,11 @@ auto ImageFileHeader::NumberOfSymbols() const -> unsigned int
 {
     try
     {
-        return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+        return this->bFile->Read<unsigned int>(this->offset + 0x000C);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -216,9 +216,9 @@ auto ImageFileHeader::NumberOfSymbols(const unsigned int& numberOfSymbols) -> vo
     {
         this->bFile->WriteUnsignedInt(this->offset + 0x000C, numberOfSymbols);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -226,11 +226,11 @@ auto ImageFileHeader::SizeOfOptionalHeader() const -> unsigned short
 {
     try
     {
-        return this->bFile->ReadUnsignedShort(this->offset + 0x0010);
+        return this->bFile->Read<unsigned short>(this->offset + 0x0010);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -240,9 +240,9 @@ auto ImageFileHeader::SizeOfOptionalHeader(const unsigned short& sizeOfOptionalH
     {
         this->bFile->WriteUnsignedShort(this->offset + 0x0010, sizeOfOptionalHeader);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -250,11 +250,11 @@ auto ImageFileHeader::Characteristics() const -> FileCharacteristicsType
 {
     try
     {
-        return static_cast<FileCharacteristicsType>(this->bFile->ReadUnsignedShort(this->offset + 0x0012));
+        return static_cast<FileCharacteristicsType>(this->bFile->Read<unsigned short>(this->offset + 0x0012));
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
     }
 }
 
@@ -264,8 +264,20 @@ auto ImageFileHeader::Characteristics(FileCharacteristicsType fileCharacteristic
     {
         this->bFile->WriteUnsignedShort(this->offset + 0x0012, (unsigned short)fileCharacteristicsType);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception&)
     {
-        throw ex;
+        throw;
+    }
+}
+
+auto ImageFileHeader::Snapshot() const -> FileHeaderSnapshot
+{
+    try
+    {
+        return this->bFile->Read<FileHeaderSnapshot>(this->offset);
+    }
+    catch (const std::exception&)
+    {
+        throw;
     }
 }
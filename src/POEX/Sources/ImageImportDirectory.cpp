@@ -1,5 +1,6 @@
 #include "../Headers/ImageImportDirectory.h"
-#include "../Headers/Utils.h"
+#include "../Headers/ArchitectureView.h"
+#include <algorithm>
 
 /**
 * Portable Executable (POEX) Project
@@ -7,10 +8,10 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageImportDirectory::ImageImportDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-	const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, const unsigned int& iatVirtualSize,
-	bool is64Bit) : bFile(bFile), offset(offset), imageSectionHeaders(imageSectionHeaders), 
-	iatVirtualSize(iatVirtualSize), is64Bit(is64Bit)
+ImageImportDirectory::ImageImportDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
+	const std::shared_ptr<const SectionIndex>& sectionIndex, const unsigned int& iatVirtualSize,
+	bool is64Bit) : bFile(bFile), sectionIndex(sectionIndex), 
+	iatVirtualSize(iatVirtualSize), offset(offset), is64Bit(is64Bit)
 {
 	if (WRONG_LONG(this->offset))
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
@@ -20,11 +21,11 @@ auto ImageImportDirectory::ImportLookupTable() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -34,9 +35,9 @@ auto ImageImportDirectory::ImportLookupTable(const unsigned int& importLookupTab
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0000, importLookupTable);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -44,11 +45,11 @@ auto ImageImportDirectory::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -58,9 +59,9 @@ auto ImageImportDirectory::TimeDateStamp(const unsigned int& timeDateStamp) -> v
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, timeDateStamp);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -68,11 +69,11 @@ auto ImageImportDirectory::ForwarderChain() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0008);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -82,9 +83,9 @@ auto ImageImportDirectory::ForwarderChain(const unsigned int& forwarderChain) ->
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0008, forwarderChain);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -92,11 +93,11 @@ auto ImageImportDirectory::Name() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -106,9 +107,9 @@ auto ImageImportDirectory::Name(const unsigned int& name) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, name);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -116,11 +117,11 @@ auto ImageImportDirectory::ImportAddressTable() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -130,9 +131,9 @@ auto ImageImportDirectory::ImportAddressTable(const unsigned int& importAddressT
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, importAddressTable);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -150,31 +151,44 @@ auto ImageImportDirectory::GetImportedFunctions() -> std::vector<ImportFunction>
 		auto ordinalBit = is64Bit ? ORDINAL_BIT_64 : ORDINAL_BIT_86;
 		auto ordinalMask = (unsigned long)(is64Bit ? ORDINAL_MASK_64 : ORDINAL_MASK_86);
 
-		auto dllAddress = Utils::RvaToOffset(this->Name(), imageSectionHeaders);
+		auto dllAddress = this->sectionIndex->RvaToOffset(this->Name());
 		auto dll = this->bFile->ReadAsciiString(dllAddress);
 		auto tempAddress = this->ImportLookupTable() != 0 ? this->ImportLookupTable() : this->ImportAddressTable();
 		if (tempAddress == 0)
 			return std::vector<ImportFunction>();
 
-		auto thunkAddress = Utils::RvaToOffset(tempAddress, imageSectionHeaders);
+		auto thunkAddress = this->sectionIndex->RvaToOffset(tempAddress);
+		auto importAddressTable = this->ImportAddressTable();
 		unsigned int iterator = 0;
 		std::vector<ImportFunction> importFunctions;
 
+		// The thunk table is null terminated, so read it in blocks of thunks instead of one by one.
+		const size_t thunksPerBlock = 64;
+		std::vector<unsigned long long> thunks;
 		while (true)
 		{
-			auto offset = thunkAddress + iterator * sizeOfThunk;
-			auto addressOfData = this->is64Bit ? this->bFile->ReadUnsignedLong(offset) : this->bFile->ReadUnsignedInt(offset);
+			if (iterator % thunksPerBlock == 0)
+			{
+				auto offset = thunkAddress + static_cast<long>(iterator * sizeOfThunk);
+				auto available = offset < 0 || static_cast<size_t>(offset) > this->bFile->Length() ? 0 :
+					(this->bFile->Length() - offset) / sizeOfThunk;
+				// A missing terminator still fails like reading the thunk would.
+				auto count = std::max<size_t>(1, std::min(thunksPerBlock, available));
+				thunks = ReadThunks(offset, count);
+			}
+
+			auto addressOfData = thunks[iterator % thunksPerBlock];
 			if (addressOfData == 0)
 				break;
-			auto iatOffset = this->ImportAddressTable() + iterator * sizeOfThunk - iatVirtualSize;
+			auto iatOffset = importAddressTable + iterator * sizeOfThunk - iatVirtualSize;
 
 			// import by ordinal
 			if ((addressOfData & ordinalBit) == ordinalBit)
 				importFunctions.push_back(ImportFunction(std::string(), dll, (unsigned short)(addressOfData & ordinalMask), iatOffset));
 			else // import by name
 			{
-				auto baseOffset = Utils::RvaToOffset(addressOfData, imageSectionHeaders);
-				auto hint = this->bFile->ReadUnsignedShort(baseOffset);
+				auto baseOffset = this->sectionIndex->RvaToOffset(static_cast<unsigned int>(addressOfData));
+				auto hint = this->bFile->Read<unsigned short>(baseOffset);
 				auto name = this->bFile->ReadAsciiString(baseOffset + 0x0002);
 				importFunctions.push_back(ImportFunction(name, dll, hint, iatOffset));
 			}
@@ -183,8 +197,231 @@ auto ImageImportDirectory::GetImportedFunctions() -> std::vector<ImportFunction>
 
 		return importFunctions;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ImageImportDirectory::ReadThunks(const long& offset, const size_t& count) -> std::vector<unsigned long long>
+{
+	if (this->is64Bit)
+		return this->bFile->ReadArray<unsigned long long>(offset, count);
+
+	auto thunks = this->bFile->ReadArray<unsigned int>(offset, count);
+	return std::vector<unsigned long long>(thunks.begin(), thunks.end());
+}
+
+auto ImageImportDirectory::ImportedFunctions() const -> ImportFunctionRange
+{
+	try
+	{
+		auto thunkTable = this->ImportLookupTable() != 0 ? this->ImportLookupTable() : this->ImportAddressTable();
+		if (this->Name() == 0 || thunkTable == 0)
+			return ImportFunctionRange();
+
+		return ImportFunctionRange(this->bFile, this->sectionIndex, this->sectionIndex->RvaToOffset(this->Name()),
+			this->sectionIndex->RvaToOffset(thunkTable), this->ImportAddressTable() - this->iatVirtualSize, this->is64Bit);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+ImportFunctionRange::ImportFunctionRange(const std::shared_ptr<IRaw>& bFile, const std::shared_ptr<const SectionIndex>& sectionIndex,
+	const long& dllOffset, const long& thunkOffset, const unsigned int& iatOffset, bool is64Bit) : bFile(bFile),
+	sectionIndex(sectionIndex), dllOffset(dllOffset), thunkOffset(thunkOffset), iatOffset(iatOffset),
+	decode(is64Bit ? &Iterator::DecodeThunk<Pe64> : &Iterator::DecodeThunk<Pe32>)
+{
+}
+
+auto ImportFunctionRange::begin() const -> Iterator
+{
+	if (this->bFile == nullptr)
+		return Iterator();
+	return Iterator(this, 0);
+}
+
+auto ImportFunctionRange::end() const -> Iterator
+{
+	return Iterator();
+}
+
+ImportFunctionRange::Iterator::Iterator(const ImportFunctionRange* range, const unsigned int& index) : range(range), index(index)
+{
+	Start();
+}
+
+ImportFunctionRange::Iterator::Iterator(const Iterator& iterator) : range(iterator.range), index(iterator.index)
+{
+	// The views may point into the storage of the other iterator, so decode again.
+	Start();
+}
+
+auto ImportFunctionRange::Iterator::operator=(const Iterator& iterator) -> Iterator&
+{
+	this->range = iterator.range;
+	this->index = iterator.index;
+	Start();
+	return *this;
+}
+
+auto ImportFunctionRange::Iterator::operator*() const -> reference
+{
+	return this->current;
+}
+
+auto ImportFunctionRange::Iterator::operator->() const -> pointer
+{
+	return &this->current;
+}
+
+auto ImportFunctionRange::Iterator::operator++() -> Iterator&
+{
+	this->index++;
+	Decode();
+	return *this;
+}
+
+auto ImportFunctionRange::Iterator::operator++(int) -> Iterator
+{
+	auto iterator = *this;
+	++(*this);
+	return iterator;
+}
+
+auto ImportFunctionRange::Iterator::operator==(const Iterator& iterator) const -> bool
+{
+	return this->range == iterator.range && this->index == iterator.index;
+}
+
+auto ImportFunctionRange::Iterator::operator!=(const Iterator& iterator) const -> bool
+{
+	return !(*this == iterator);
+}
+
+auto ImportFunctionRange::Iterator::Start() -> void
+{
+	if (this->range == nullptr)
+		return;
+	this->current.Dll = this->range->bFile->ViewAsciiString(this->range->dllOffset, this->dll);
+	Decode();
+}
+
+auto ImportFunctionRange::Iterator::Decode() -> void
+{
+	if (this->range == nullptr)
+		return;
+	(this->*(this->range->decode))();
+}
+
+template <typename Architecture>
+auto ImportFunctionRange::Iterator::DecodeThunk() -> void
+{
+	auto& bFile = this->range->bFile;
+	auto thunk = ImportThunkView<Architecture>(bFile,
+		this->range->thunkOffset + static_cast<long>(this->index * ImportThunkView<Architecture>::Size));
+
+	// The thunk table is null terminated, the end iterator has no range.
+	if (thunk.AddressOfData() == 0)
+	{
+		this->range = nullptr;
+		this->index = 0;
+		this->current = ImportFunctionView();
+		return;
+	}
+
+	this->current.IATOffset = this->range->iatOffset + this->index * static_cast<unsigned int>(ImportThunkView<Architecture>::Size);
+	this->current.ByOrdinal = thunk.ByOrdinal();
+
+	// import by ordinal
+	if (this->current.ByOrdinal)
+	{
+		this->current.Hint = thunk.Ordinal();
+		this->current.Name = std::string_view();
+	}
+	else // import by name
+	{
+		auto baseOffset = this->range->sectionIndex->RvaToOffset(thunk.HintNameRva());
+		this->current.Hint = bFile->Read<unsigned short>(baseOffset);
+		this->current.Name = bFile->ViewAsciiString(baseOffset + 0x0002, this->name);
+	}
+}
+
+ImportDescriptorRange::ImportDescriptorRange(const std::shared_ptr<IRaw>& bFile, const std::shared_ptr<const SectionIndex>& sectionIndex,
+	const long& offset, const unsigned int& iatVirtualSize, bool is64Bit) : bFile(bFile), sectionIndex(sectionIndex),
+	offset(offset), iatVirtualSize(iatVirtualSize), is64Bit(is64Bit)
+{
+}
+
+auto ImportDescriptorRange::begin() const -> Iterator
+{
+	if (this->bFile == nullptr || WRONG_LONG(this->offset))
+		return Iterator();
+	return Iterator(this, 0);
+}
+
+auto ImportDescriptorRange::end() const -> Iterator
+{
+	return Iterator();
+}
+
+ImportDescriptorRange::Iterator::Iterator(const ImportDescriptorRange* range, const unsigned int& index) : range(range), index(index)
+{
+	Decode();
+}
+
+auto ImportDescriptorRange::Iterator::operator*() const -> reference
+{
+	return *this->current;
+}
+
+auto ImportDescriptorRange::Iterator::operator->() const -> pointer
+{
+	return &*this->current;
+}
+
+auto ImportDescriptorRange::Iterator::operator++() -> Iterator&
+{
+	this->index++;
+	Decode();
+	return *this;
+}
+
+auto ImportDescriptorRange::Iterator::operator++(int) -> Iterator
+{
+	auto iterator = *this;
+	++(*this);
+	return iterator;
+}
+
+auto ImportDescriptorRange::Iterator::operator==(const Iterator& iterator) const -> bool
+{
+	return this->range == iterator.range && this->index == iterator.index;
+}
+
+auto ImportDescriptorRange::Iterator::operator!=(const Iterator& iterator) const -> bool
+{
+	return !(*this == iterator);
+}
+
+auto ImportDescriptorRange::Iterator::Decode() -> void
+{
+	if (this->range == nullptr)
+		return;
+
+	this->current.emplace(this->range->bFile, this->range->offset + IMPORT_TABLE_SIZE * static_cast<long>(this->index),
+		this->range->sectionIndex, this->range->iatVirtualSize, this->range->is64Bit);
+
+	// Found the last ImageImportDescriptor which is completely null (except TimeDateStamp).
+	if (this->current->ImportLookupTable() == 0 &&
+		this->current->ForwarderChain() == 0 &&
+		this->current->Name() == 0 &&
+		this->current->ImportAddressTable() == 0)
 	{
-		throw ex;
+		this->range = nullptr;
+		this->index = 0;
+		this->current.reset();
 	}
 }
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageLoadConfigDirectory::ImageLoadConfigDirectory(const std::shared_ptr<BufferFile>& bFile, 
+ImageLoadConfigDirectory::ImageLoadConfigDirectory(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset, const bool& is64Bit) :
 	bFile(bFile), offset(offset), is64Bit(is64Bit)
 {
@@ -18,11 +18,11 @@ auto ImageLoadConfigDirectory::Size() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0000);
+		return this->bFile->Read<unsigned int>(offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -32,9 +32,9 @@ auto ImageLoadConfigDirectory::Size(const unsigned int& size) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0000, size);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -42,11 +42,11 @@ auto ImageLoadConfigDirectory::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0004);
+		return this->bFile->Read<unsigned int>(offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -56,9 +56,9 @@ auto ImageLoadConfigDirectory::TimeDateStamp(const unsigned int& time) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0004, time);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -66,11 +66,11 @@ auto ImageLoadConfigDirectory::MajorVesion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x0008);
+		return this->bFile->Read<unsigned short>(offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -80,9 +80,9 @@ auto ImageLoadConfigDirectory::MajorVesion(const unsigned short& majorVersion) -
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x0008, majorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -90,11 +90,11 @@ auto ImageLoadConfigDirectory::MinorVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x000A);
+		return this->bFile->Read<unsigned short>(offset + 0x000A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -104,9 +104,9 @@ auto ImageLoadConfigDirectory::MinorVersion(const unsigned short& minorVersion)
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x000A, minorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -114,11 +114,11 @@ auto ImageLoadConfigDirectory::GlobalFlagsClear() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x000C);
+		return this->bFile->Read<unsigned int>(offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -128,9 +128,9 @@ auto ImageLoadConfigDirectory::GlobalFlagsClear(const unsigned int& globalFlagsC
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x000C, globalFlagsClear);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -138,11 +138,11 @@ auto ImageLoadConfigDirectory::GlobalFlagsSet() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0010);
+		return this->bFile->Read<unsigned int>(offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -152,9 +152,9 @@ auto ImageLoadConfigDirectory::GlobalFlagsSet(const unsigned int& globalFlagsSet
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0010, globalFlagsSet);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -162,11 +162,11 @@ auto ImageLoadConfigDirectory::CriticalSectionDefaultTimeout() const -> unsigned
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0014);
+		return this->bFile->Read<unsigned int>(offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -176,9 +176,9 @@ auto ImageLoadConfigDirectory::CriticalSectionDefaultTimeout(const unsigned int&
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0014, criticalSectionDefaultTimeout);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -187,12 +187,12 @@ auto ImageLoadConfigDirectory::DeCommitFreeBlockThreshold() const -> unsigned lo
 	try
 	{
 		return is64Bit ? 
-			this->bFile->ReadUnsignedLong(offset + 0x0018) : 
-			this->bFile->ReadUnsignedInt(offset + 0x0018);
+			this->bFile->Read<unsigned long>(offset + 0x0018) : 
+			this->bFile->Read<unsigned int>(offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -205,9 +205,9 @@ auto ImageLoadConfigDirectory::DeCommitFreeBlockThreshold(const unsigned long& d
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0018, (unsigned int)deCommitFreeBlockThreshold);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -216,12 +216,12 @@ auto ImageLoadConfigDirectory::DeCommitTotalFreeThreshold() const -> unsigned lo
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0020) :
-			this->bFile->ReadUnsignedInt(offset + 0x001C);
+			this->bFile->Read<unsigned long>(offset + 0x0020) :
+			this->bFile->Read<unsigned int>(offset + 0x001C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -234,9 +234,9 @@ auto ImageLoadConfigDirectory::DeCommitTotalFreeThreshold(const unsigned long& d
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x001C, (unsigned int)deCommitTotalFreeThreshold);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -245,12 +245,12 @@ auto ImageLoadConfigDirectory::LockPrefixTable() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0028) :
-			this->bFile->ReadUnsignedInt(offset + 0x0020);
+			this->bFile->Read<unsigned long>(offset + 0x0028) :
+			this->bFile->Read<unsigned int>(offset + 0x0020);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -263,9 +263,9 @@ auto ImageLoadConfigDirectory::LockPrefixTable(const unsigned long& lockPrefixTa
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0020, (unsigned int)lockPrefixTable);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -274,12 +274,12 @@ auto ImageLoadConfigDirectory::MaximumAllocationSize() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0030) :
-			this->bFile->ReadUnsignedInt(offset + 0x0024);
+			this->bFile->Read<unsigned long>(offset + 0x0030) :
+			this->bFile->Read<unsigned int>(offset + 0x0024);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -292,9 +292,9 @@ auto ImageLoadConfigDirectory::MaximumAllocationSize(const unsigned long& maximu
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0024, (unsigned int)maximumAllocationSize);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -303,12 +303,12 @@ auto ImageLoadConfigDirectory::VirtualMemoryThreshold() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0038) :
-			this->bFile->ReadUnsignedInt(offset + 0x0028);
+			this->bFile->Read<unsigned long>(offset + 0x0038) :
+			this->bFile->Read<unsigned int>(offset + 0x0028);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -321,9 +321,9 @@ auto ImageLoadConfigDirectory::VirtualMemoryThreshold(const unsigned long& virtu
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0028, (unsigned int)virtualMemoryThreshold);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -332,12 +332,12 @@ auto ImageLoadConfigDirectory::ProcessAffinityMask() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0040) :
-			this->bFile->ReadUnsignedInt(offset + 0x0030);
+			this->bFile->Read<unsigned long>(offset + 0x0040) :
+			this->bFile->Read<unsigned int>(offset + 0x0030);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -350,9 +350,9 @@ auto ImageLoadConfigDirectory::ProcessAffinityMask(const unsigned long& processA
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0030, (unsigned int)processAffinityMask);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -361,12 +361,12 @@ auto ImageLoadConfigDirectory::ProcessHeapFlags() const -> unsigned int
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedInt(offset + 0x0048) :
-			this->bFile->ReadUnsignedInt(offset + 0x002C);
+			this->bFile->Read<unsigned int>(offset + 0x0048) :
+			this->bFile->Read<unsigned int>(offset + 0x002C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -379,9 +379,9 @@ auto ImageLoadConfigDirectory::ProcessHeapFlags(const unsigned int& processHeapF
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x002C, processHeapFlags);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -390,12 +390,12 @@ auto ImageLoadConfigDirectory::CSDVersion() const -> unsigned short
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedShort(offset + 0x004C) :
-			this->bFile->ReadUnsignedShort(offset + 0x0034);
+			this->bFile->Read<unsigned short>(offset + 0x004C) :
+			this->bFile->Read<unsigned short>(offset + 0x0034);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -408,9 +408,9 @@ auto ImageLoadConfigDirectory::CSDVersion(const unsigned short& cSDVersion) -> v
 		else
 			this->bFile->WriteUnsignedShort(offset + 0x0034, cSDVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -419,12 +419,12 @@ auto ImageLoadConfigDirectory::Reserved1() const -> unsigned short
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedShort(offset + 0x004E) :
-			this->bFile->ReadUnsignedShort(offset + 0x0036);
+			this->bFile->Read<unsigned short>(offset + 0x004E) :
+			this->bFile->Read<unsigned short>(offset + 0x0036);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -437,9 +437,9 @@ auto ImageLoadConfigDirectory::Reserved1(const unsigned short& reserved1) -> voi
 		else
 			this->bFile->WriteUnsignedShort(offset + 0x0036, reserved1);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -448,12 +448,12 @@ auto ImageLoadConfigDirectory::EditList() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0050) :
-			this->bFile->ReadUnsignedInt(offset + 0x0038);
+			this->bFile->Read<unsigned long>(offset + 0x0050) :
+			this->bFile->Read<unsigned int>(offset + 0x0038);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -466,9 +466,9 @@ auto ImageLoadConfigDirectory::EditList(const unsigned long& editList) -> void
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0038, (unsigned int)editList);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -477,12 +477,12 @@ auto ImageLoadConfigDirectory::SecurityCoockie() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0058) :
-			this->bFile->ReadUnsignedInt(offset + 0x003C);
+			this->bFile->Read<unsigned long>(offset + 0x0058) :
+			this->bFile->Read<unsigned int>(offset + 0x003C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -495,9 +495,9 @@ auto ImageLoadConfigDirectory::SecurityCoockie(const unsigned long& securityCooc
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x003C, (unsigned int)securityCoockie);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -506,12 +506,12 @@ auto ImageLoadConfigDirectory::SEHandlerTable() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0060) :
-			this->bFile->ReadUnsignedInt(offset + 0x0040);
+			this->bFile->Read<unsigned long>(offset + 0x0060) :
+			this->bFile->Read<unsigned int>(offset + 0x0040);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -524,9 +524,9 @@ auto ImageLoadConfigDirectory::SEHandlerTable(const unsigned long& sEHandlerTabl
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0040, (unsigned int)sEHandlerTable);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -535,12 +535,12 @@ auto ImageLoadConfigDirectory::SEHandlerCount() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0068) :
-			this->bFile->ReadUnsignedInt(offset + 0x0044);
+			this->bFile->Read<unsigned long>(offset + 0x0068) :
+			this->bFile->Read<unsigned int>(offset + 0x0044);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -553,9 +553,9 @@ auto ImageLoadConfigDirectory::SEHandlerCount(const unsigned long& sEHandlerCoun
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0044, (unsigned int)sEHandlerCount);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -564,12 +564,12 @@ auto ImageLoadConfigDirectory::GuardCFCheckFunctionPointer() const -> unsigned l
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0070) :
-			this->bFile->ReadUnsignedInt(offset + 0x0048);
+			this->bFile->Read<unsigned long>(offset + 0x0070) :
+			this->bFile->Read<unsigned int>(offset + 0x0048);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -582,9 +582,9 @@ auto ImageLoadConfigDirectory::GuardCFCheckFunctionPointer(const unsigned long&
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0048, (unsigned int)guardCFCheckFunctionPointer);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -593,12 +593,12 @@ auto ImageLoadConfigDirectory::Reserved2() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0078) :
-			this->bFile->ReadUnsignedInt(offset + 0x004C);
+			this->bFile->Read<unsigned long>(offset + 0x0078) :
+			this->bFile->Read<unsigned int>(offset + 0x004C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -611,9 +611,9 @@ auto ImageLoadConfigDirectory::Reserved2(const unsigned long& reserved2) -> void
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x004C, (unsigned int)reserved2);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -622,12 +622,12 @@ auto ImageLoadConfigDirectory::GuardCFFunctionTable() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0080) :
-			this->bFile->ReadUnsignedInt(offset + 0x0050);
+			this->bFile->Read<unsigned long>(offset + 0x0080) :
+			this->bFile->Read<unsigned int>(offset + 0x0050);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -640,9 +640,9 @@ auto ImageLoadConfigDirectory::GuardCFFunctionTable(const unsigned long& guardCF
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0050, (unsigned int)guardCFFunctionTable);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -651,12 +651,12 @@ auto ImageLoadConfigDirectory::GuardCFFunctionCount() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(offset + 0x0088) :
-			this->bFile->ReadUnsignedInt(offset + 0x0054);
+			this->bFile->Read<unsigned long>(offset + 0x0088) :
+			this->bFile->Read<unsigned int>(offset + 0x0054);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -669,9 +669,9 @@ auto ImageLoadConfigDirectory::GuardCFFunctionCount(const unsigned long& guardCF
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0054, (unsigned int)guardCFFunctionCount);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -680,12 +680,12 @@ auto ImageLoadConfigDirectory::GuardFlags() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedInt(offset + 0x0090) :
-			this->bFile->ReadUnsignedInt(offset + 0x0058);
+			this->bFile->Read<unsigned int>(offset + 0x0090) :
+			this->bFile->Read<unsigned int>(offset + 0x0058);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -698,8 +698,8 @@ auto ImageLoadConfigDirectory::GuardFlags(const unsigned long& guardFlags) -> vo
 		else
 			this->bFile->WriteUnsignedInt(offset + 0x0058, guardFlags);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
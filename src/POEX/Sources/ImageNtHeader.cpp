@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageNtHeader::ImageNtHeader(const std::shared_ptr<BufferFile>& bFile, 
+ImageNtHeader::ImageNtHeader(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset) : bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(offset))
@@ -17,11 +17,11 @@ auto ImageNtHeader::Signature() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000000);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000000);
 	}
-	catch (const std::exception& ex) 
+	catch (const std::exception&) 
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -31,9 +31,9 @@ auto ImageNtHeader::Signature(const unsigned int& sig) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000000, sig);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -43,9 +43,9 @@ auto ImageNtHeader::FileHeader() const -> ImageFileHeader
 	{
 		return ImageFileHeader(this->bFile, this->offset + 0x000004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -54,12 +54,12 @@ auto ImageNtHeader::OptionalHeader() const -> ImageOptionalHeader
 	try
 	{
 		auto is64Bit =
-			this->bFile->ReadUnsignedShort(this->bFile->ReadUnsignedInt(0x003C) + 0x0018)
-			== unsigned short(FileType::BIT64);
+			this->bFile->Read<unsigned short>(this->bFile->Read<unsigned int>(0x003C) + 0x0018)
+			== static_cast<unsigned short>(FileType::BIT64);
 		return ImageOptionalHeader(this->bFile, this->offset + 0x000018, is64Bit);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
\ No newline at end of file
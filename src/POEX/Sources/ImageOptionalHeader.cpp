@@ -1,4 +1,5 @@
 #include "../Headers/ImageOptionalHeader.h"
+#include <cstring>
 
 /**
 * Portable Executable (POEX) Project
@@ -6,7 +7,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageOptionalHeader::ImageOptionalHeader(const std::shared_ptr<BufferFile>& bFile, 
+ImageOptionalHeader::ImageOptionalHeader(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset, 
 	const bool& is64Bit) : bFile(bFile), offset(offset), is64Bit(is64Bit)
 {
@@ -36,9 +37,9 @@ auto ImageOptionalHeader::ToString(SubsystemType subsystem) -> std::string
 		default: return "NOT FOUND SUBSYSTEM TYPE";
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -62,9 +63,9 @@ auto ImageOptionalHeader::ToString(DllCharacteristicsType dllCharacteristicsType
 		default: return "NOT FOUND DllCharacteristicsType";
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -80,9 +81,9 @@ auto ImageOptionalHeader::ToString(FileType fileType) -> std::string
 		default: return "NOT FOUND FILE TYPE";
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -107,9 +108,9 @@ auto ImageOptionalHeader::DataDirectory() -> std::vector<std::unique_ptr<ImageDa
 
 		return dDirectory;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -117,11 +118,11 @@ auto ImageOptionalHeader::Magic() const -> FileType
 {
 	try
 	{
-		return (FileType)this->bFile->ReadUnsignedShort(this->offset + 0x0000);
+		return (FileType)this->bFile->Read<unsigned short>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -131,9 +132,9 @@ auto ImageOptionalHeader::Magic(const FileType& fileType) -> void
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0000, (unsigned short)fileType);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -141,11 +142,11 @@ auto ImageOptionalHeader::MajorLinkerVersion() const -> byte
 {
 	try
 	{
-		return this->bFile->ReadByte(this->offset + 0x0002);
+		return this->bFile->Read<byte>(this->offset + 0x0002);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -155,9 +156,9 @@ auto ImageOptionalHeader::MajorLinkerVersion(const byte& mlVersion)
 	{
 		this->bFile->WriteByte(this->offset + 0x0002, mlVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -165,11 +166,11 @@ auto ImageOptionalHeader::MinorLinkerVersion() const -> byte
 {
 	try
 	{
-		return this->bFile->ReadByte(this->offset + 0x0003);
+		return this->bFile->Read<byte>(this->offset + 0x0003);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -179,9 +180,9 @@ auto ImageOptionalHeader::MinorLinkerVersion(const byte& mlVersion)
 	{
 		this->bFile->WriteByte(this->offset + 0x0003, mlVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -189,11 +190,11 @@ auto ImageOptionalHeader::SizeOfCode() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0004);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -203,9 +204,9 @@ auto ImageOptionalHeader::SizeOfCode(const unsigned int& sizeOfCode) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0004, sizeOfCode);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -213,11 +214,11 @@ auto ImageOptionalHeader::SizeOfInitializedData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0008);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -227,9 +228,9 @@ auto ImageOptionalHeader::SizeOfInitializedData(const unsigned int& sizeOfInitia
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0008, sizeOfInitializedData);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -237,11 +238,11 @@ auto ImageOptionalHeader::SizeOfUninitializedData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -251,9 +252,9 @@ auto ImageOptionalHeader::SizeOfUninitializedData(const unsigned int& sizeOfUnin
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, sizeOfUninitializedData);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -261,11 +262,11 @@ auto ImageOptionalHeader::AddressOfEntryPoint() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -275,9 +276,9 @@ auto ImageOptionalHeader::AddressOfEntryPoint(const unsigned int& addressOfEntry
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0010, addressOfEntryPoint);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -285,11 +286,11 @@ auto ImageOptionalHeader::BaseOfCode() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -299,9 +300,9 @@ auto ImageOptionalHeader::BaseOfCode(const unsigned int& baseOfCode) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0014, baseOfCode);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -309,11 +310,11 @@ auto ImageOptionalHeader::BaseOfData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0018);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -326,9 +327,9 @@ auto ImageOptionalHeader::BaseOfData(const unsigned int& baseOfData) -> void
 		else
 			THROW_EXCEPTION("[ERROR] OptionalHeader->BaseOfData does not exist in 64 bit applications.");
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -337,12 +338,12 @@ auto ImageOptionalHeader::ImageBase() const -> unsigned long
 	try
 	{
 		return this->is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 0x0018) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x001C);
+			this->bFile->Read<unsigned long>(this->offset + 0x0018) :
+			this->bFile->Read<unsigned int>(this->offset + 0x001C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -352,11 +353,11 @@ auto ImageOptionalHeader::ImageBase(const unsigned long& imageBase) -> void
 	{
 		this->is64Bit ?
 			this->bFile->WriteUnsignedLong(this->offset + 0x0018, imageBase) :
-			this->bFile->WriteUnsignedInt(this->offset + 0x001C, unsigned int(imageBase));
+			this->bFile->WriteUnsignedInt(this->offset + 0x001C, static_cast<unsigned int>(imageBase));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -364,11 +365,11 @@ auto ImageOptionalHeader::SectionAlignment() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0020);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0020);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -378,9 +379,9 @@ auto ImageOptionalHeader::SectionAlignment(const unsigned int& sectionAlignment)
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0020, sectionAlignment);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -388,11 +389,11 @@ auto ImageOptionalHeader::FileAlignment() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0024);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0024);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -402,9 +403,9 @@ auto ImageOptionalHeader::FileAlignment(const unsigned int& fileAlignment) -> vo
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0024, fileAlignment);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -412,11 +413,11 @@ auto ImageOptionalHeader::MajorOperatingSystemVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0028);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0028);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -426,9 +427,9 @@ auto ImageOptionalHeader::MajorOperatingSystemVersion(const unsigned short& majo
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0028, majorOperatingSystemVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -436,11 +437,11 @@ auto ImageOptionalHeader::MinorOperatingSystemVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x002A);
+		return this->bFile->Read<unsigned short>(this->offset + 0x002A);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -450,9 +451,9 @@ auto ImageOptionalHeader::MinorOperatingSystemVersion(const unsigned short& mino
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x002A, minorOperatingSystemVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -460,11 +461,11 @@ auto ImageOptionalHeader::MajorImageVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x002C);
+		return this->bFile->Read<unsigned short>(this->offset + 0x002C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -474,9 +475,9 @@ auto ImageOptionalHeader::MajorImageVersion(const unsigned short& majorImageVers
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x002C, majorImageVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -484,11 +485,11 @@ auto ImageOptionalHeader::MinorImageVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x002E);
+		return this->bFile->Read<unsigned short>(this->offset + 0x002E);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -498,9 +499,9 @@ auto ImageOptionalHeader::MinorImageVersion(const unsigned short& minorImageVers
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x002E, minorImageVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -508,11 +509,11 @@ auto ImageOptionalHeader::MajorSubsystemVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0030);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0030);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -522,9 +523,9 @@ auto ImageOptionalHeader::MajorSubsystemVersion(const unsigned short& majorSubsy
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0030, majorSubsystemVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -532,11 +533,11 @@ auto ImageOptionalHeader::MinorSubsystemVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0032);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0032);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -546,9 +547,9 @@ auto ImageOptionalHeader::MinorSubsystemVersion(const unsigned short& minorSubsy
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0032, minorSubsystemVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -556,11 +557,11 @@ auto ImageOptionalHeader::Win32VersionValue() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0034);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0034);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -570,9 +571,9 @@ auto ImageOptionalHeader::Win32VersionValue(const unsigned int& win32VersionValu
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0034, win32VersionValue);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -580,11 +581,11 @@ auto ImageOptionalHeader::SizeOfImage() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0038);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0038);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -594,9 +595,9 @@ auto ImageOptionalHeader::SizeOfImage(const unsigned int& sizeOfImage) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0038, sizeOfImage);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -604,11 +605,11 @@ auto ImageOptionalHeader::SizeOfHeaders() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x003C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x003C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -618,9 +619,9 @@ auto ImageOptionalHeader::SizeOfHeaders(const unsigned int& sizeOfHeaders) -> vo
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x003C, sizeOfHeaders);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -628,11 +629,11 @@ auto ImageOptionalHeader::CheckSum() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0040);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0040);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -642,9 +643,9 @@ auto ImageOptionalHeader::CheckSum(const unsigned int& checkSum) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0040, checkSum);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -652,11 +653,11 @@ auto ImageOptionalHeader::Subsystem() const -> SubsystemType
 {
 	try
 	{
-		return (SubsystemType)this->bFile->ReadUnsignedShort(this->offset + 0x0044);
+		return (SubsystemType)this->bFile->Read<unsigned short>(this->offset + 0x0044);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -666,9 +667,9 @@ auto ImageOptionalHeader::Subsystem(const SubsystemType& systemType) -> void
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0044, (unsigned short)systemType);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -676,11 +677,11 @@ auto ImageOptionalHeader::DllCharacteristics() const -> DllCharacteristicsType
 {
 	try
 	{
-		return (DllCharacteristicsType)this->bFile->ReadUnsignedShort(this->offset + 0x0046);
+		return (DllCharacteristicsType)this->bFile->Read<unsigned short>(this->offset + 0x0046);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -690,9 +691,9 @@ auto ImageOptionalHeader::DllCharacteristics(const DllCharacteristicsType& dllCh
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0046, (unsigned short)dllCharacteristicsType);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -701,12 +702,12 @@ auto ImageOptionalHeader::SizeOfStackReserve() const -> unsigned long
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedLong(this->offset + 0x0048)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x0048);
+			? this->bFile->Read<unsigned long>(this->offset + 0x0048)
+			: this->bFile->Read<unsigned int>(this->offset + 0x0048);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -718,9 +719,9 @@ auto ImageOptionalHeader::SizeOfStackReserve(const unsigned long& sizeOfStackRes
 			? this->bFile->WriteUnsignedLong(this->offset + 0x0048, sizeOfStackReserve)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x0048, (unsigned int)sizeOfStackReserve);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -729,12 +730,12 @@ auto ImageOptionalHeader::SizeOfStackCommit() const -> unsigned long
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedLong(this->offset + 0x0050)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x004C);
+			? this->bFile->Read<unsigned long>(this->offset + 0x0050)
+			: this->bFile->Read<unsigned int>(this->offset + 0x004C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -746,9 +747,9 @@ auto ImageOptionalHeader::SizeOfStackCommit(const unsigned long& sizeOfStackComm
 			? this->bFile->WriteUnsignedLong(this->offset + 0x0050, sizeOfStackCommit)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x004C, (unsigned int)sizeOfStackCommit);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -757,12 +758,12 @@ auto ImageOptionalHeader::SizeOfHeapReserve() const -> unsigned long
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedLong(this->offset + 0x0058)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x0050);
+			? this->bFile->Read<unsigned long>(this->offset + 0x0058)
+			: this->bFile->Read<unsigned int>(this->offset + 0x0050);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -774,9 +775,9 @@ auto ImageOptionalHeader::SizeOfHeapReserve(const unsigned long& sizeOfHeapReser
 			? this->bFile->WriteUnsignedLong(this->offset + 0x0058, sizeOfHeapReserve)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x0050, (unsigned int)sizeOfHeapReserve);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -785,12 +786,12 @@ auto ImageOptionalHeader::SizeOfHeapCommit() const -> unsigned long
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedLong(this->offset + 0x0060)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x0054);
+			? this->bFile->Read<unsigned long>(this->offset + 0x0060)
+			: this->bFile->Read<unsigned int>(this->offset + 0x0054);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -802,9 +803,9 @@ auto ImageOptionalHeader::SizeOfHeapCommit(const unsigned long& sizeOfHeapCommit
 			? this->bFile->WriteUnsignedLong(this->offset + 0x0060, sizeOfHeapCommit)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x0054, (unsigned int)sizeOfHeapCommit);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -813,12 +814,12 @@ auto ImageOptionalHeader::LoaderFlags() const -> unsigned int
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedInt(this->offset + 0x0068)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x0058);
+			? this->bFile->Read<unsigned int>(this->offset + 0x0068)
+			: this->bFile->Read<unsigned int>(this->offset + 0x0058);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -830,9 +831,9 @@ auto ImageOptionalHeader::LoaderFlags(const unsigned int& loaderFlags) -> void
 			? this->bFile->WriteUnsignedInt(this->offset + 0x0068, loaderFlags)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x0058, (unsigned int)loaderFlags);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -841,12 +842,12 @@ auto ImageOptionalHeader::NumberOfRvaAndSizes() const -> unsigned int
 	try
 	{
 		return this->is64Bit
-			? this->bFile->ReadUnsignedInt(this->offset + 0x006C)
-			: this->bFile->ReadUnsignedInt(this->offset + 0x005C);
+			? this->bFile->Read<unsigned int>(this->offset + 0x006C)
+			: this->bFile->Read<unsigned int>(this->offset + 0x005C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -858,8 +859,75 @@ auto ImageOptionalHeader::NumberOfRvaAndSizes(const unsigned int& numberOfRvaAnd
 			? this->bFile->WriteUnsignedInt(this->offset + 0x006C, numberOfRvaAndSizes)
 			: this->bFile->WriteUnsignedInt(this->offset + 0x005C, numberOfRvaAndSizes);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
-}
\ No newline at end of file
+}
+
+auto ImageOptionalHeader::Snapshot() const -> OptionalHeaderSnapshot
+{
+	try
+	{
+		// The header is read at once, then every field is taken from the local copy.
+		byte header[0x00F0];
+		auto size = this->is64Bit ? sizeof(header) : static_cast<size_t>(0x00E0);
+		this->bFile->ReadBytes(this->offset, header, size);
+
+		auto field = [&header](auto& value, const size_t& position) {
+			std::memcpy(&value, header + position, sizeof(value));
+		};
+		auto address = [&](unsigned long long& value, const size_t& position) {
+			if (this->is64Bit)
+				field(value, position);
+			else
+			{
+				unsigned int narrow;
+				field(narrow, position);
+				value = narrow;
+			}
+		};
+
+		OptionalHeaderSnapshot snapshot{};
+		field(snapshot.Magic, 0x0000);
+		field(snapshot.MajorLinkerVersion, 0x0002);
+		field(snapshot.MinorLinkerVersion, 0x0003);
+		field(snapshot.SizeOfCode, 0x0004);
+		field(snapshot.SizeOfInitializedData, 0x0008);
+		field(snapshot.SizeOfUninitializedData, 0x000C);
+		field(snapshot.AddressOfEntryPoint, 0x0010);
+		field(snapshot.BaseOfCode, 0x0014);
+		if (!this->is64Bit)
+			field(snapshot.BaseOfData, 0x0018);
+		address(snapshot.ImageBase, this->is64Bit ? 0x0018 : 0x001C);
+		field(snapshot.SectionAlignment, 0x0020);
+		field(snapshot.FileAlignment, 0x0024);
+		field(snapshot.MajorOperatingSystemVersion, 0x0028);
+		field(snapshot.MinorOperatingSystemVersion, 0x002A);
+		field(snapshot.MajorImageVersion, 0x002C);
+		field(snapshot.MinorImageVersion, 0x002E);
+		field(snapshot.MajorSubsystemVersion, 0x0030);
+		field(snapshot.MinorSubsystemVersion, 0x0032);
+		field(snapshot.Win32VersionValue, 0x0034);
+		field(snapshot.SizeOfImage, 0x0038);
+		field(snapshot.SizeOfHeaders, 0x003C);
+		field(snapshot.CheckSum, 0x0040);
+		field(snapshot.Subsystem, 0x0044);
+		field(snapshot.DllCharacteristics, 0x0046);
+
+		// From here on PE32+ fields are 4 bytes wider.
+		auto width = this->is64Bit ? sizeof(unsigned long long) : sizeof(unsigned int);
+		address(snapshot.SizeOfStackReserve, 0x0048);
+		address(snapshot.SizeOfStackCommit, 0x0048 + width);
+		address(snapshot.SizeOfHeapReserve, 0x0048 + 2 * width);
+		address(snapshot.SizeOfHeapCommit, 0x0048 + 3 * width);
+		field(snapshot.LoaderFlags, 0x0048 + 4 * width);
+		field(snapshot.NumberOfRvaAndSizes, 0x004C + 4 * width);
+		std::memcpy(snapshot.DataDirectory, header + 0x0050 + 4 * width, sizeof(snapshot.DataDirectory));
+		return snapshot;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageResourceDirectory::ImageResourceDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
+ImageResourceDirectory::ImageResourceDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
 	const long& resourceDirectoryOffset, const long& resourceDirectoryLength) :
 	bFile(bFile), offset(offset), resourceDirectoryOffset(resourceDirectoryOffset), 
 	resourceDirectoryLength(resourceDirectoryLength)
@@ -15,10 +15,10 @@ ImageResourceDirectory::ImageResourceDirectory(const std::shared_ptr<BufferFile>
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
 }
 
-ImageResourceDirectory::ImageResourceDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
+ImageResourceDirectory::ImageResourceDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
 	const std::shared_ptr<ImageResourceDirectoryEntry>& parent, const long& resourceDirectoryOffset, 
 	const long& resourceDirectoryLength) :
-	bFile(bFile), offset(offset), parent(parent), resourceDirectoryOffset(resourceDirectoryOffset),
+	bFile(bFile), parent(parent), offset(offset), resourceDirectoryOffset(resourceDirectoryOffset),
 	resourceDirectoryLength(resourceDirectoryLength)
 {
 	if (WRONG_LONG(this->offset))
@@ -37,44 +37,38 @@ auto ImageResourceDirectory::ImageResourceDirectoryEntries() -> std::vector<std:
 		if (DirectoryEntries.size() == 0)
 			return std::vector<std::shared_ptr<ImageResourceDirectoryEntry>>();
 
-		// Parse the second stage (type)
-		for (auto de : DirectoryEntries)
+		// Only the entries of this directory are decoded, their subdirectories are expanded on demand.
+		// Use Tree() to decode the whole resource directory at once.
+		for (auto& de : DirectoryEntries)
 		{
-			// This check only applies to the second level.
-			if (de->IsIdEntry() && de->NameResolve() == "unknown")
+			// This check only applies to the type level, the entries of the root directory.
+			if (offset == resourceDirectoryOffset && de->IsIdEntry() && de->NameResolve() == "unknown")
 				continue;
 
-			auto b = std::make_shared<ImageResourceDirectory>(bFile,
-				offset + de->OffsetToDirectory(), de, offset, resourceDirectoryLength);
-			de->ResourceDirectory(b);
-
-			auto sndLevel = de->ResourceDirectory()->ImageResourceDirectoryEntries();
-			if (sndLevel.size() == 0)
+			if (!de->DataIsDirectory())
 				continue;
 
-			for (auto de2 : sndLevel)
-			{
-				auto a = std::make_shared<ImageResourceDirectory>(bFile,
-					offset + de2->OffsetToDirectory(), de2, offset, resourceDirectoryLength);
-				de2->ResourceDirectory(a);
-
-				auto thrdLevel = de2->ResourceDirectory()->ImageResourceDirectoryEntries();
-				if (thrdLevel.size() == 0)
-					continue;
-
-				for (auto de3 : thrdLevel)
-				{
-					std::shared_ptr<ImageResourceDirectory> c(new ImageResourceDirectory(bFile,
-						offset + de3->OffsetToDirectory(), de3, offset, resourceDirectoryLength));
-					de3->ResourceDirectory(c);
-				}
-			}
+			de->ResourceDirectory(std::make_shared<ImageResourceDirectory>(bFile,
+				resourceDirectoryOffset + de->OffsetToDirectory(), de, resourceDirectoryOffset, resourceDirectoryLength));
 		}
 		return DirectoryEntries;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ImageResourceDirectory::Tree() const -> ResourceTree
+{
+	try
+	{
+		return ResourceTree(this->bFile, this->resourceDirectoryOffset, 
+			static_cast<unsigned int>(this->resourceDirectoryLength));
+	}
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -92,11 +86,11 @@ auto ImageResourceDirectory::Characteristics() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset);
+		return this->bFile->Read<unsigned int>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -106,9 +100,9 @@ auto ImageResourceDirectory::Characteristics(const unsigned int& characteristics
 	{
 		this->bFile->WriteUnsignedInt(offset, characteristics);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -116,11 +110,11 @@ auto ImageResourceDirectory::TimeDateStamp() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x0004);
+		return this->bFile->Read<unsigned int>(offset + 0x0004);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -130,9 +124,9 @@ auto ImageResourceDirectory::TimeDateStamp(const unsigned int& time) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x0004, time);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -140,11 +134,11 @@ auto ImageResourceDirectory::MajorVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x0008);
+		return this->bFile->Read<unsigned short>(offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -154,9 +148,9 @@ auto ImageResourceDirectory::MajorVersion(const unsigned short& majorVersion) ->
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x0008, majorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -164,11 +158,11 @@ auto ImageResourceDirectory::MinorVersion() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x000a);
+		return this->bFile->Read<unsigned short>(offset + 0x000a);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -178,9 +172,9 @@ auto ImageResourceDirectory::MinorVersion(const unsigned short& minorVersion) ->
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x000a, minorVersion);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -188,11 +182,11 @@ auto ImageResourceDirectory::NumberOfNameEntries() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x000c);
+		return this->bFile->Read<unsigned short>(offset + 0x000c);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -202,9 +196,9 @@ auto ImageResourceDirectory::NumberOfNameEntries(const unsigned short& nameEntir
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x000c, nameEntires);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -212,11 +206,11 @@ auto ImageResourceDirectory::NumberOfIdEntries() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset + 0x000e);
+		return this->bFile->Read<unsigned short>(offset + 0x000e);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -226,9 +220,9 @@ auto ImageResourceDirectory::NumberOfIdEntries(const unsigned short& idEntires)
 	{
 		this->bFile->WriteUnsignedShort(offset + 0x000e, idEntires);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -236,14 +230,17 @@ auto ImageResourceDirectory::ParseDirectoryEntries() -> std::vector<std::shared_
 {
 	try
 	{
-		auto numEntries = NumberOfIdEntries() + NumberOfNameEntries();
+		auto numEntries = static_cast<size_t>(NumberOfIdEntries()) + NumberOfNameEntries();
 		std::vector<std::shared_ptr<ImageResourceDirectoryEntry>> entries;
+		entries.reserve(numEntries);
+
+		// All entries share one copy of this directory as their parent.
+		auto self = std::make_shared<ImageResourceDirectory>(*this);
 		for (size_t i = 0; i < numEntries; i++)
 		{
 			try
 			{
-				auto entry = std::make_shared<ImageResourceDirectoryEntry>(this->bFile, 
-					std::make_shared<ImageResourceDirectory>(*this),
+				auto entry = std::make_shared<ImageResourceDirectoryEntry>(this->bFile, self,
 					(long)i * 8 + offset + 16, resourceDirectoryOffset);
 
 				if (SanityCheckFailed(entry))
@@ -259,9 +256,9 @@ auto ImageResourceDirectory::ParseDirectoryEntries() -> std::vector<std::shared_
 		}
 		return entries;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -283,13 +280,13 @@ auto ImageResourceDirectory::SanityCheckFailed(const std::shared_ptr<ImageResour
 
 		return false;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-ImageResourceDirectoryEntry::ImageResourceDirectoryEntry(const std::shared_ptr<BufferFile>& bFile, 
+ImageResourceDirectoryEntry::ImageResourceDirectoryEntry(const std::shared_ptr<IRaw>& bFile, 
 	const std::shared_ptr<ImageResourceDirectory>& parent, const long& offset, const long& resourceDirectoryOffset) :
 	bFile(bFile), parent(parent), offset(offset), resourceDirectoryOffset(resourceDirectoryOffset)
 {
@@ -307,9 +304,9 @@ ImageResourceDirectoryEntry::ImageResourceDirectoryEntry(const std::shared_ptr<B
 			NameResolved = std::string(unicodeName->NameString().begin(), unicodeName->NameString().end());
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -319,9 +316,9 @@ auto ImageResourceDirectoryEntry::Parent() const -> std::shared_ptr<ImageResourc
 	{
 		return this->parent;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -334,11 +331,11 @@ auto ImageResourceDirectoryEntry::Name() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset);
+		return this->bFile->Read<unsigned int>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -348,9 +345,9 @@ auto ImageResourceDirectoryEntry::Name(const unsigned int& name) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset, name);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -360,9 +357,9 @@ auto ImageResourceDirectoryEntry::ID() const -> unsigned int
 	{
 		return Name() & 0xFFFF;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -372,9 +369,9 @@ auto ImageResourceDirectoryEntry::ID(const unsigned int& id) -> void
 	{
 		Name(id & 0xFFFF);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -382,11 +379,11 @@ auto ImageResourceDirectoryEntry::OffsetToData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(offset + 0x4);
+		return this->bFile->Read<unsigned int>(offset + 0x4);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -396,9 +393,9 @@ auto ImageResourceDirectoryEntry::OffsetToData(const unsigned int off) -> void
 	{
 		this->bFile->WriteUnsignedInt(offset + 0x4, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -408,9 +405,9 @@ auto ImageResourceDirectoryEntry::OffsetToDirectory() -> unsigned int
 	{
 		return OffsetToData() & 0x7FFFFFFF;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -422,9 +419,9 @@ auto ImageResourceDirectoryEntry::DataIsDirectory() -> bool
 			return true;
 		return false;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -436,9 +433,9 @@ auto ImageResourceDirectoryEntry::IsNamedEntry() -> bool
 			return true;
 		return false;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -448,9 +445,9 @@ auto ImageResourceDirectoryEntry::IsIdEntry() -> bool
 	{
 		return !IsNamedEntry();
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -483,13 +480,13 @@ auto ImageResourceDirectoryEntry::ResolveResourceId(const unsigned int& id) -> s
 			default: return "unknown";
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-ImageResourceDirStringU::ImageResourceDirStringU(const std::shared_ptr<BufferFile>& bFile, const long& offset) :
+ImageResourceDirStringU::ImageResourceDirStringU(const std::shared_ptr<IRaw>& bFile, const long& offset) :
 	bFile(bFile), offset(offset)
 {
 	if (WRONG_LONG(this->offset))
@@ -500,11 +497,11 @@ auto ImageResourceDirStringU::Length() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(offset);
+		return this->bFile->Read<unsigned short>(offset);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -514,9 +511,9 @@ auto ImageResourceDirStringU::Length(const unsigned short& len) -> void
 	{
 		this->bFile->WriteUnsignedShort(offset, len);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -526,8 +523,8 @@ auto ImageResourceDirStringU::NameString() const -> std::wstring
 	{
 		return this->bFile->ReadUnicodeString(offset + 2, Length());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
@@ -1,4 +1,4 @@
-#include "..\Headers\ImageSectionHeader.h"
+#include "../Headers/ImageSectionHeader.h"
 
 /**
 * Portable Executable (POEX) Project
@@ -6,7 +6,7 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageSectionHeader::ImageSectionHeader(const std::shared_ptr<BufferFile>& bFile, 
+ImageSectionHeader::ImageSectionHeader(const std::shared_ptr<IRaw>& bFile, 
 	const long& offset, 
 	const unsigned long& imageBaseAddress) : bFile(bFile), offset(offset), imageBaseAddress(imageBaseAddress)
 {
@@ -59,9 +59,9 @@ auto ImageSectionHeader::ToString(SectionFlag sectionFlag) -> std::string
 		default: return "NOT FOUND SectionFlag.";
 		}
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -77,9 +77,9 @@ auto ImageSectionHeader::Name() const -> std::string
 		auto nameArr = bFile->SubArray(this->offset, 8);
 		return std::string(nameArr.begin(), nameArr.end());
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -95,11 +95,11 @@ auto ImageSectionHeader::VirtualSize() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0008);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -109,9 +109,9 @@ auto ImageSectionHeader::VirtualSize(const unsigned int& virtualSize) -> void
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0008, virtualSize);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -119,11 +119,11 @@ auto ImageSectionHeader::VirtualAddress() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -133,9 +133,9 @@ auto ImageSectionHeader::VirtualAddress(const unsigned int& virtualAddress) -> v
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x000C, virtualAddress);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -143,11 +143,11 @@ auto ImageSectionHeader::SizeOfRawData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -157,9 +157,9 @@ auto ImageSectionHeader::SizeOfRawData(const unsigned int& sizeOfRawData) -> voi
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0010, sizeOfRawData);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -167,11 +167,11 @@ auto ImageSectionHeader::PointerToRawData() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -181,9 +181,9 @@ auto ImageSectionHeader::PointerToRawData(const unsigned int& pointerToRawData)
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0014, pointerToRawData);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -191,11 +191,11 @@ auto ImageSectionHeader::PointerToRelocations() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x0018);
+		return this->bFile->Read<unsigned int>(this->offset + 0x0018);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -205,9 +205,9 @@ auto ImageSectionHeader::PointerToRelocations(const unsigned int& pointerToReloc
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0018, pointerToRelocations);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -215,11 +215,11 @@ auto ImageSectionHeader::PointerToLinenumbers() const -> unsigned int
 {
 	try
 	{
-		return this->bFile->ReadUnsignedInt(this->offset + 0x001C);
+		return this->bFile->Read<unsigned int>(this->offset + 0x001C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -229,9 +229,9 @@ auto ImageSectionHeader::PointerToLinenumbers(const unsigned int& pointerToLinen
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x001C, pointerToLinenumbers);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -239,11 +239,11 @@ auto ImageSectionHeader::NumberOfRelocations() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0020);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0020);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -253,9 +253,9 @@ auto ImageSectionHeader::NumberOfRelocations(const unsigned short& numberOfReloc
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0020, numberOfRelocations);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -263,11 +263,11 @@ auto ImageSectionHeader::NumberOfLinenumbers() const -> unsigned short
 {
 	try
 	{
-		return this->bFile->ReadUnsignedShort(this->offset + 0x0022);
+		return this->bFile->Read<unsigned short>(this->offset + 0x0022);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -277,9 +277,9 @@ auto ImageSectionHeader::NumberOfLinenumbers(const unsigned short& numberOfLinen
 	{
 		this->bFile->WriteUnsignedShort(this->offset + 0x0022, numberOfLinenumbers);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -287,11 +287,11 @@ auto ImageSectionHeader::Characteristics() const -> SectionFlag
 {
 	try
 	{
-		return SectionFlag(this->bFile->ReadUnsignedInt(this->offset + 0x0024));
+		return SectionFlag(this->bFile->Read<unsigned int>(this->offset + 0x0024));
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -301,9 +301,9 @@ auto ImageSectionHeader::Characteristics(const SectionFlag& characteristics) ->
 	{
 		this->bFile->WriteUnsignedInt(this->offset + 0x0024, (unsigned int)characteristics);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -315,15 +315,15 @@ auto ImageSectionHeader::ToArray() -> std::vector<byte>
 		header.reserve(SECTION_HEADER_SIZE); // Section header size is 40 bytes
 
 		auto name = this->FixedNameLength(this->Name());
-		auto virtualSize = this->bFile->ToBytesArray(this->VirtualSize());
-		auto virtualAddress = this->bFile->ToBytesArray(this->VirtualAddress());
-		auto sizeOfRawData = this->bFile->ToBytesArray(this->SizeOfRawData());
-		auto pointerToRawData = this->bFile->ToBytesArray(this->PointerToRawData());
-		auto pointerToRelocations = this->bFile->ToBytesArray(this->PointerToRelocations());
-		auto pointerToLinenumbers = this->bFile->ToBytesArray(this->PointerToLinenumbers());
-		auto numberOfRelocations = this->bFile->ToBytesArray(this->NumberOfRelocations());
-		auto numberOfLinenumbers = this->bFile->ToBytesArray(this->NumberOfLinenumbers());
-		auto characteristics = this->bFile->ToBytesArray((unsigned int)this->Characteristics());
+		auto virtualSize = BufferFile::ToBytesArray(this->VirtualSize());
+		auto virtualAddress = BufferFile::ToBytesArray(this->VirtualAddress());
+		auto sizeOfRawData = BufferFile::ToBytesArray(this->SizeOfRawData());
+		auto pointerToRawData = BufferFile::ToBytesArray(this->PointerToRawData());
+		auto pointerToRelocations = BufferFile::ToBytesArray(this->PointerToRelocations());
+		auto pointerToLinenumbers = BufferFile::ToBytesArray(this->PointerToLinenumbers());
+		auto numberOfRelocations = BufferFile::ToBytesArray(this->NumberOfRelocations());
+		auto numberOfLinenumbers = BufferFile::ToBytesArray(this->NumberOfLinenumbers());
+		auto characteristics = BufferFile::ToBytesArray((unsigned int)this->Characteristics());
 
 		header.insert(header.end(), name.begin(), name.end());
 		header.insert(header.end(), virtualSize.begin(), virtualSize.end());
@@ -338,9 +338,9 @@ auto ImageSectionHeader::ToArray() -> std::vector<byte>
 
 		return header;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -356,8 +356,20 @@ auto ImageSectionHeader::FixedNameLength(const std::string& name) -> std::vector
 
 		return nameArr;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
+	}
+}
+
+auto ImageSectionHeader::Snapshot() const -> SectionHeaderSnapshot
+{
+	try
+	{
+		return this->bFile->Read<SectionHeaderSnapshot>(this->offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
 	}
 }
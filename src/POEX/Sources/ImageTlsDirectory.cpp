@@ -1,5 +1,4 @@
 #include "../Headers/ImageTlsDirectory.h"
-#include "../Headers/Utils.h"
 
 /**
 * Portable Executable (POEX) Project
@@ -7,9 +6,9 @@
 * Url: https://github.com/AFP33/POEX
 */
 
-ImageTlsDirectory::ImageTlsDirectory(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
-	const std::vector<std::shared_ptr<ImageSectionHeader>>& imageSectionHeaders, const bool& is64Bit) :
-	bFile(bFile), offset(offset), imageSectionHeaders(imageSectionHeaders), is64Bit(is64Bit)
+ImageTlsDirectory::ImageTlsDirectory(const std::shared_ptr<IRaw>& bFile, const long& offset, 
+	const std::shared_ptr<const SectionIndex>& sectionIndex, const bool& is64Bit) :
+	sectionIndex(sectionIndex), bFile(bFile), offset(offset), is64Bit(is64Bit)
 {
 	if (WRONG_LONG(this->offset))
 		THROW_EXCEPTION("[ERROR] offset value is wrong.");
@@ -21,7 +20,7 @@ auto ImageTlsDirectory::Callbacks() -> std::vector<ImageTlsCallback>
 	{
 		std::vector<ImageTlsCallback> callbacks;
 		auto addressOfCallbacks = AddressOfCallBacks();
-		auto rawAddressOfCallbacks = Utils::VaToOffset(addressOfCallbacks, this->imageSectionHeaders);
+		auto rawAddressOfCallbacks = this->sectionIndex->VaToOffset(addressOfCallbacks);
 
 		unsigned int iterator = 0;
 		while (true)
@@ -49,9 +48,9 @@ auto ImageTlsDirectory::Callbacks() -> std::vector<ImageTlsCallback>
 		}
 		return callbacks;
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -60,12 +59,12 @@ auto ImageTlsDirectory::StartAddressOfRawData() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 0x0000) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+			this->bFile->Read<unsigned long>(this->offset + 0x0000) :
+			this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -78,9 +77,9 @@ auto ImageTlsDirectory::StartAddressOfRawData(const unsigned long& off) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0000, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -89,12 +88,12 @@ auto ImageTlsDirectory::EndAddressOfRawData() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 8) :
-			this->bFile->ReadUnsignedInt(this->offset + 4);
+			this->bFile->Read<unsigned long>(this->offset + 8) :
+			this->bFile->Read<unsigned int>(this->offset + 4);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -107,9 +106,9 @@ auto ImageTlsDirectory::EndAddressOfRawData(const unsigned long& off) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0004, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -118,12 +117,12 @@ auto ImageTlsDirectory::AddressOfIndex() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 0x0010) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x0008);
+			this->bFile->Read<unsigned long>(this->offset + 0x0010) :
+			this->bFile->Read<unsigned int>(this->offset + 0x0008);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -136,9 +135,9 @@ auto ImageTlsDirectory::AddressOfIndex(const unsigned long& off) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0008, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -147,12 +146,12 @@ auto ImageTlsDirectory::AddressOfCallBacks() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 0x0018) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x000C);
+			this->bFile->Read<unsigned long>(this->offset + 0x0018) :
+			this->bFile->Read<unsigned int>(this->offset + 0x000C);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -165,9 +164,9 @@ auto ImageTlsDirectory::AddressOfCallBacks(const unsigned long& off) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x000C, off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -176,12 +175,12 @@ auto ImageTlsDirectory::SizeOfZeroFill() const -> unsigned int
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedInt(this->offset + 0x0020) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x0010);
+			this->bFile->Read<unsigned int>(this->offset + 0x0020) :
+			this->bFile->Read<unsigned int>(this->offset + 0x0010);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -194,9 +193,9 @@ auto ImageTlsDirectory::SizeOfZeroFill(const unsigned int& length) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0010, length);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -205,12 +204,12 @@ auto ImageTlsDirectory::Characteristics() const -> unsigned int
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedInt(this->offset + 0x0024) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x0014);
+			this->bFile->Read<unsigned int>(this->offset + 0x0024) :
+			this->bFile->Read<unsigned int>(this->offset + 0x0014);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -223,13 +222,13 @@ auto ImageTlsDirectory::Characteristics(const unsigned int& characteristics) ->
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0014, characteristics);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
-ImageTlsCallback::ImageTlsCallback(const std::shared_ptr<BufferFile>& bFile, const long& offset, 
+ImageTlsCallback::ImageTlsCallback(const std::shared_ptr<IRaw>& bFile, const long& offset, 
 	const bool& is64Bit) :
 	bFile(bFile), offset(offset), is64Bit(is64Bit)
 {
@@ -242,12 +241,12 @@ auto ImageTlsCallback::Callback() const -> unsigned long
 	try
 	{
 		return is64Bit ?
-			this->bFile->ReadUnsignedLong(this->offset + 0x0000) :
-			this->bFile->ReadUnsignedInt(this->offset + 0x0000);
+			this->bFile->Read<unsigned long>(this->offset + 0x0000) :
+			this->bFile->Read<unsigned int>(this->offset + 0x0000);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -260,8 +259,8 @@ auto ImageTlsCallback::Callback(const unsigned long& off) -> void
 		else
 			this->bFile->WriteUnsignedInt(this->offset + 0x0000, (unsigned int)off);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
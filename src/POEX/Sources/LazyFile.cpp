@@ -0,0 +1,409 @@
+#include "../Headers/LazyFile.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+LazyFile::LazyFile(const std::filesystem::path& filepath, const size_t& cachedPages)
+	: cachedPages(std::max<size_t>(cachedPages, 1))
+{
+	if (filepath.empty())
+		THROW_OUT_OF_RANGE("[ERROR] filepath cann't be empty.");
+
+#ifdef _WIN32
+	this->file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+	if (this->file == INVALID_HANDLE_VALUE)
+	{
+		this->file = nullptr;
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(this->file, &size) || size.QuadPart == 0)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] data cann't be empty.");
+	}
+	this->length = static_cast<size_t>(size.QuadPart);
+#else
+	this->descriptor = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (this->descriptor < 0)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+
+	struct stat status;
+	if (fstat(this->descriptor, &status) != 0 || status.st_size <= 0)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] data cann't be empty.");
+	}
+	this->length = static_cast<size_t>(status.st_size);
+
+	// Reads are scattered over the file, read ahead would only waste I/O.
+	posix_fadvise(this->descriptor, 0, 0, POSIX_FADV_RANDOM);
+#endif
+}
+
+LazyFile::~LazyFile()
+{
+	Close();
+}
+
+auto LazyFile::SubArray(const long& offset, const int& length) -> std::vector<byte>
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		std::vector<byte> bytes(length);
+		Copy(offset, bytes.data(), bytes.size());
+		return bytes;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadBytes(const long& offset, byte* destination, const size_t& length) -> void
+{
+	try
+	{
+		Copy(offset, destination, length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadByte(const long& offset) -> byte
+{
+	try
+	{
+		return ReadValue<byte>(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadUnsignedShort(const long& offset) -> unsigned short
+{
+	try
+	{
+		return ReadValue<unsigned short>(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadUnsignedInt(const long& offset) -> unsigned int
+{
+	try
+	{
+		return ReadValue<unsigned int>(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadUnsignedLong(const long& offset) -> unsigned long
+{
+	try
+	{
+		return ReadValue<unsigned long>(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::WriteByte(const long& offset, const byte& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::WriteBytes(const long& offset, const std::vector<byte>& bytes) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::WriteUnsignedShort(const long& offset, const unsigned short& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::WriteUnsignedLong(const long& offset, const unsigned long& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::WriteUnsignedInt(const long& offset, const unsigned int& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::ReadUnicodeString(const long& offset) -> std::wstring
+{
+	try
+	{
+		CheckRange(offset, sizeof(unsigned short));
+		std::wstring str;
+		for (auto pos = static_cast<size_t>(offset); pos + 1 < this->length; pos += 2)
+		{
+			auto character = static_cast<wchar_t>(ReadValue<unsigned short>(static_cast<long>(pos)));
+			if (character == 0x0000)
+				break;
+			str.push_back(character);
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadUnicodeString(const long& offset, const long& length) -> std::wstring
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		std::vector<byte> bytes(static_cast<size_t>(length) * 2);
+		Copy(offset, bytes.data(), bytes.size());
+		std::wstring str;
+		str.reserve(length);
+		for (size_t i = 0; i < bytes.size(); i += 2)
+			str.push_back(static_cast<wchar_t>(bytes[i] | (bytes[i + 1] << 8)));
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::ReadAsciiString(const long& offset) -> std::string
+{
+	try
+	{
+		CheckRange(offset, sizeof(byte));
+		std::string str;
+		auto pos = static_cast<size_t>(offset);
+		std::lock_guard<std::mutex> lock(this->mutex);
+		while (pos < this->length)
+		{
+			// Scan the rest of the current page at once.
+			auto& page = Page(pos / PageSize);
+			auto begin = reinterpret_cast<const char*>(page.data()) + pos % PageSize;
+			auto size = page.size() - pos % PageSize;
+			auto end = static_cast<const char*>(std::memchr(begin, 0x00, size));
+			if (end != nullptr)
+			{
+				str.append(begin, end);
+				break;
+			}
+			str.append(begin, size);
+			pos += size;
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::Data() -> ByteView
+{
+	try
+	{
+		std::lock_guard<std::mutex> lock(this->mutex);
+		if (this->image.empty())
+		{
+			std::vector<byte> image(this->length);
+			ReadAt(0, image.data(), image.size());
+			this->image = std::move(image);
+			// The whole file is in memory now, later reads don't need the page cache.
+			Contiguous(this->image.data(), this->image.size());
+		}
+		return ByteView{ this->image.data(), this->image.size() };
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto LazyFile::Length() -> size_t
+{
+	return this->length;
+}
+
+auto LazyFile::RemoveRange(const long& offset, const unsigned long length) -> void
+{
+	THROW_RUNTIME("[ERROR] Lazy file is read-only.");
+}
+
+auto LazyFile::FileDescriptor(const long& offset, const size_t& length) -> int
+{
+#ifdef _WIN32
+	return -1;
+#else
+	if (offset < 0 || static_cast<size_t>(offset) > this->length || length > this->length - offset)
+		return -1;
+	return this->descriptor;
+#endif
+}
+
+auto LazyFile::BytesRead() const -> unsigned long long
+{
+	std::lock_guard<std::mutex> lock(this->mutex);
+	return this->bytesRead;
+}
+
+auto LazyFile::Prime(const size_t& offset, const byte* data, const size_t& size) -> void
+{
+	if (offset % PageSize != 0 || offset > this->length || size > this->length - offset)
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+
+	std::lock_guard<std::mutex> lock(this->mutex);
+	this->bytesRead += size;
+	if (!this->image.empty())
+		return;
+
+	for (size_t done = 0; done < size; done += PageSize)
+	{
+		auto number = (offset + done) / PageSize;
+		auto count = std::min(PageSize, this->length - offset - done);
+		if (size - done < count)
+			break;
+		if (this->pageIndex.find(number) != this->pageIndex.end())
+			continue;
+
+		auto page = FreePage();
+		page.assign(data + done, data + done + count);
+		this->pages.emplace_front(number, std::move(page));
+		this->pageIndex.emplace(number, this->pages.begin());
+	}
+}
+
+auto LazyFile::Page(const size_t& number) -> const std::vector<byte>&
+{
+	auto cached = this->pageIndex.find(number);
+	if (cached != this->pageIndex.end())
+	{
+		// Move the page to the front, the back is always the least recently used one.
+		this->pages.splice(this->pages.begin(), this->pages, cached->second);
+		return cached->second->second;
+	}
+
+	auto page = FreePage();
+	auto offset = number * PageSize;
+	page.resize(std::min(PageSize, this->length - offset));
+	ReadAt(offset, page.data(), page.size());
+
+	this->pages.emplace_front(number, std::move(page));
+	this->pageIndex.emplace(number, this->pages.begin());
+	return this->pages.front().second;
+}
+
+auto LazyFile::FreePage() -> std::vector<byte>
+{
+	std::vector<byte> page;
+	if (this->pages.size() >= this->cachedPages)
+	{
+		// Reuse the buffer of the evicted page.
+		page = std::move(this->pages.back().second);
+		this->pageIndex.erase(this->pages.back().first);
+		this->pages.pop_back();
+	}
+	return page;
+}
+
+auto LazyFile::Copy(const long& offset, byte* destination, const size_t& size) -> void
+{
+	CheckRange(offset, size);
+	std::lock_guard<std::mutex> lock(this->mutex);
+	if (!this->image.empty())
+	{
+		std::memcpy(destination, this->image.data() + offset, size);
+		return;
+	}
+
+	auto pos = static_cast<size_t>(offset);
+	auto end = pos + size;
+	while (pos < end)
+	{
+		auto& page = Page(pos / PageSize);
+		auto count = std::min(end - pos, page.size() - pos % PageSize);
+		std::memcpy(destination, page.data() + pos % PageSize, count);
+		destination += count;
+		pos += count;
+	}
+}
+
+auto LazyFile::ReadAt(const size_t& offset, byte* destination, const size_t& size) -> void
+{
+	size_t done = 0;
+	while (done < size)
+	{
+#ifdef _WIN32
+		OVERLAPPED overlapped = {};
+		overlapped.Offset = static_cast<DWORD>((offset + done) & 0xFFFFFFFF);
+		overlapped.OffsetHigh = static_cast<DWORD>(static_cast<unsigned long long>(offset + done) >> 32);
+		DWORD count = 0;
+		auto chunk = static_cast<DWORD>(std::min<size_t>(size - done, 0x40000000));
+		if (!ReadFile(this->file, destination + done, chunk, &count, &overlapped) || count == 0)
+			THROW_RUNTIME("[ERROR] Reading file fail.");
+#else
+		auto count = pread(this->descriptor, destination + done, size - done, static_cast<off_t>(offset + done));
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			THROW_RUNTIME("[ERROR] Reading file fail.");
+#endif
+		done += static_cast<size_t>(count);
+		this->bytesRead += static_cast<unsigned long long>(count);
+	}
+}
+
+auto LazyFile::CheckRange(const long& offset, const size_t& size) const -> void
+{
+	if (offset < 0 || static_cast<size_t>(offset) > this->length || size > this->length - offset)
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+}
+
+auto LazyFile::Close() -> void
+{
+#ifdef _WIN32
+	if (this->file != nullptr)
+		CloseHandle(this->file);
+	this->file = nullptr;
+#else
+	if (this->descriptor >= 0)
+		close(this->descriptor);
+	this->descriptor = -1;
+#endif
+}
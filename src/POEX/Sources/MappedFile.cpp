@@ -0,0 +1,332 @@
+#include "../Headers/MappedFile.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+MappedFile::MappedFile(const std::filesystem::path& filepath)
+{
+	if (filepath.empty())
+		THROW_OUT_OF_RANGE("[ERROR] filepath cann't be empty.");
+
+#ifdef _WIN32
+	this->file = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+	if (this->file == INVALID_HANDLE_VALUE)
+	{
+		this->file = nullptr;
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	}
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(this->file, &size) || size.QuadPart == 0)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] data cann't be empty.");
+	}
+	this->length = static_cast<size_t>(size.QuadPart);
+
+	this->mapping = CreateFileMappingW(this->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (this->mapping == NULL)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] Mapping file fail.");
+	}
+
+	this->data = static_cast<const byte*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+	if (this->data == nullptr)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] Mapping file fail.");
+	}
+	Contiguous(this->data, this->length);
+#else
+	this->descriptor = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+	if (this->descriptor < 0)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+
+	struct stat status;
+	if (fstat(this->descriptor, &status) != 0 || status.st_size <= 0)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] data cann't be empty.");
+	}
+	this->length = static_cast<size_t>(status.st_size);
+
+	auto address = mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, this->descriptor, 0);
+	if (address == MAP_FAILED)
+	{
+		Close();
+		THROW_RUNTIME("[ERROR] Mapping file fail.");
+	}
+	this->data = static_cast<const byte*>(address);
+
+	// Header queries jump around the file, so don't let the kernel read ahead the whole image.
+	madvise(address, this->length, MADV_RANDOM);
+	Contiguous(this->data, this->length);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+auto MappedFile::SubArray(const long& offset, const int& length) -> std::vector<byte>
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		CheckRange(offset, length);
+		return std::vector<byte>(this->data + offset, this->data + offset + length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadBytes(const long& offset, byte* destination, const size_t& length) -> void
+{
+	try
+	{
+		CheckRange(offset, length);
+		if (length != 0)
+			std::memcpy(destination, this->data + offset, length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadByte(const long& offset) -> byte
+{
+	try
+	{
+		CheckRange(offset, sizeof(byte));
+		return this->data[offset];
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadUnsignedShort(const long& offset) -> unsigned short
+{
+	try
+	{
+		unsigned short value;
+		CheckRange(offset, sizeof(value));
+		std::memcpy(&value, this->data + offset, sizeof(value));
+		return value;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadUnsignedInt(const long& offset) -> unsigned int
+{
+	try
+	{
+		unsigned int value;
+		CheckRange(offset, sizeof(value));
+		std::memcpy(&value, this->data + offset, sizeof(value));
+		return value;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadUnsignedLong(const long& offset) -> unsigned long
+{
+	try
+	{
+		unsigned long value;
+		CheckRange(offset, sizeof(value));
+		std::memcpy(&value, this->data + offset, sizeof(value));
+		return value;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::WriteByte(const long& offset, const byte& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::WriteBytes(const long& offset, const std::vector<byte>& bytes) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::WriteUnsignedShort(const long& offset, const unsigned short& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::WriteUnsignedLong(const long& offset, const unsigned long& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::WriteUnsignedInt(const long& offset, const unsigned int& value) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::ReadUnicodeString(const long& offset) -> std::wstring
+{
+	try
+	{
+		CheckRange(offset, sizeof(unsigned short));
+		std::wstring str;
+		for (auto pos = static_cast<size_t>(offset); pos + 1 < this->length; pos += 2)
+		{
+			auto character = static_cast<wchar_t>(this->data[pos] | (this->data[pos + 1] << 8));
+			if (character == 0x0000)
+				break;
+			str.push_back(character);
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadUnicodeString(const long& offset, const long& length) -> std::wstring
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		CheckRange(offset, static_cast<size_t>(length) * 2);
+		std::wstring str;
+		str.reserve(length);
+		for (long i = 0; i < length; i++)
+		{
+			auto pos = offset + i * 2;
+			str.push_back(static_cast<wchar_t>(this->data[pos] | (this->data[pos + 1] << 8)));
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::ReadAsciiString(const long& offset) -> std::string
+{
+	try
+	{
+		CheckRange(offset, sizeof(byte));
+		auto begin = reinterpret_cast<const char*>(this->data + offset);
+		auto end = static_cast<const char*>(std::memchr(begin, 0x00, this->length - offset));
+		return end == nullptr ? std::string(begin, this->length - offset) : std::string(begin, end);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::Data() -> ByteView
+{
+	return ByteView{ this->data, this->length };
+}
+
+auto MappedFile::Length() -> size_t
+{
+	return this->length;
+}
+
+auto MappedFile::RemoveRange(const long& offset, const unsigned long length) -> void
+{
+	THROW_RUNTIME("[ERROR] Mapped file is read-only.");
+}
+
+auto MappedFile::FileDescriptor(const long& offset, const size_t& length) -> int
+{
+#ifdef _WIN32
+	return -1;
+#else
+	if (offset < 0 || static_cast<size_t>(offset) > this->length || length > this->length - offset)
+		return -1;
+	return this->descriptor;
+#endif
+}
+
+auto MappedFile::WillNeed(const long& offset, const size_t& length) -> void
+{
+	try
+	{
+		CheckRange(offset, length);
+#ifdef _WIN32
+		WIN32_MEMORY_RANGE_ENTRY range;
+		range.VirtualAddress = const_cast<byte*>(this->data + offset);
+		range.NumberOfBytes = length;
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+		// madvise needs a page aligned address.
+		auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		auto begin = static_cast<size_t>(offset) & ~(pageSize - 1);
+		madvise(const_cast<byte*>(this->data + begin), length + (offset - begin), MADV_WILLNEED);
+#endif
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto MappedFile::CheckRange(const long& offset, const size_t& size) const -> void
+{
+	if (offset < 0 || static_cast<size_t>(offset) > this->length || size > this->length - offset)
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+}
+
+auto MappedFile::Close() -> void
+{
+#ifdef _WIN32
+	if (this->data != nullptr)
+		UnmapViewOfFile(this->data);
+	if (this->mapping != nullptr)
+		CloseHandle(this->mapping);
+	if (this->file != nullptr)
+		CloseHandle(this->file);
+	this->mapping = nullptr;
+	this->file = nullptr;
+#else
+	if (this->data != nullptr)
+		munmap(const_cast<byte*>(this->data), this->length);
+	if (this->descriptor >= 0)
+		close(this->descriptor);
+	this->descriptor = -1;
+#endif
+	this->data = nullptr;
+	Contiguous(nullptr, 0);
+}
@@ -0,0 +1,379 @@
+#include "../Headers/PatchedFile.h"
+#include <algorithm>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+PatchedFile::PatchedFile(const std::shared_ptr<IRaw>& base) : base(base)
+{
+	if (this->base == nullptr)
+		THROW_OUT_OF_RANGE("[ERROR] data cann't be empty.");
+	auto block = this->base->ContiguousData();
+	Contiguous(block.Pointer, block.Length);
+}
+
+PatchedFile::PatchedFile(const PatchedFile& patchedFile) : IRaw(patchedFile), base(patchedFile.base),
+	patches(patchedFile.patches), image(patchedFile.image), materialized(patchedFile.materialized)
+{
+	// The materialized image is our own copy now.
+	if (this->materialized)
+		Contiguous(this->image.data(), this->image.size());
+}
+
+auto PatchedFile::SubArray(const long& offset, const int& length) -> std::vector<byte>
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		return ReadRange(offset, length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadBytes(const long& offset, byte* destination, const size_t& length) -> void
+{
+	try
+	{
+		CheckRange(offset, length);
+		this->base->ReadBytes(offset, destination, length);
+		if (IsPatched(offset, length))
+			Overlay(offset, destination, length);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadByte(const long& offset) -> byte
+{
+	try
+	{
+		return IsPatched(offset, sizeof(byte)) ? ReadValue<byte>(offset) : this->base->ReadByte(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadUnsignedShort(const long& offset) -> unsigned short
+{
+	try
+	{
+		return IsPatched(offset, sizeof(unsigned short)) ?
+			ReadValue<unsigned short>(offset) : this->base->ReadUnsignedShort(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadUnsignedInt(const long& offset) -> unsigned int
+{
+	try
+	{
+		return IsPatched(offset, sizeof(unsigned int)) ?
+			ReadValue<unsigned int>(offset) : this->base->ReadUnsignedInt(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadUnsignedLong(const long& offset) -> unsigned long
+{
+	try
+	{
+		return IsPatched(offset, sizeof(unsigned long)) ?
+			ReadValue<unsigned long>(offset) : this->base->ReadUnsignedLong(offset);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::WriteByte(const long& offset, const byte& value) -> void
+{
+	try
+	{
+		WriteValue<byte>(offset, value);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::WriteBytes(const long& offset, const std::vector<byte>& bytes) -> void
+{
+	try
+	{
+		if (EMPTY_VECTOR(bytes))
+			THROW_OUT_OF_RANGE("[ERROR] data cann't be empty.");
+		Patch(offset, bytes.data(), bytes.size());
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::WriteUnsignedShort(const long& offset, const unsigned short& value) -> void
+{
+	try
+	{
+		WriteValue<unsigned short>(offset, value);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::WriteUnsignedLong(const long& offset, const unsigned long& value) -> void
+{
+	try
+	{
+		WriteValue<unsigned long>(offset, value);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::WriteUnsignedInt(const long& offset, const unsigned int& value) -> void
+{
+	try
+	{
+		WriteValue<unsigned int>(offset, value);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadUnicodeString(const long& offset) -> std::wstring
+{
+	try
+	{
+		auto str = this->base->ReadUnicodeString(offset);
+		if (!IsPatched(offset, (str.size() + 1) * 2))
+			return str;
+
+		str.clear();
+		for (auto pos = offset; static_cast<size_t>(pos) + 1 < Length(); pos += 2)
+		{
+			auto character = static_cast<wchar_t>(ReadUnsignedShort(pos));
+			if (character == 0x0000)
+				break;
+			str.push_back(character);
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadUnicodeString(const long& offset, const long& length) -> std::wstring
+{
+	try
+	{
+		if (length < 0)
+			THROW_OUT_OF_RANGE("[ERROR] length value is wrong.");
+		if (!IsPatched(offset, static_cast<size_t>(length) * 2))
+			return this->base->ReadUnicodeString(offset, length);
+
+		auto bytes = ReadRange(offset, static_cast<size_t>(length) * 2);
+		std::wstring str;
+		str.reserve(length);
+		for (size_t i = 0; i < bytes.size(); i += 2)
+			str.push_back(static_cast<wchar_t>(bytes[i] | (bytes[i + 1] << 8)));
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::ReadAsciiString(const long& offset) -> std::string
+{
+	try
+	{
+		auto str = this->base->ReadAsciiString(offset);
+		if (!IsPatched(offset, std::min(str.size() + 1, Length() - offset)))
+			return str;
+
+		str.clear();
+		for (auto pos = offset; static_cast<size_t>(pos) < Length(); pos++)
+		{
+			auto character = ReadByte(pos);
+			if (character == 0x00)
+				break;
+			str.push_back(static_cast<char>(character));
+		}
+		return str;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::Data() -> ByteView
+{
+	try
+	{
+		if (this->patches.empty())
+			return this->base->Data();
+
+		if (!this->materialized)
+		{
+			this->image = this->base->Data().ToVector();
+			for (const auto& patch : this->patches)
+				std::copy(patch.second.begin(), patch.second.end(), this->image.begin() + patch.first);
+			this->materialized = true;
+			Contiguous(this->image.data(), this->image.size());
+		}
+		return ByteView{ this->image.data(), this->image.size() };
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PatchedFile::Length() -> size_t
+{
+	return this->base->Length();
+}
+
+auto PatchedFile::RemoveRange(const long& offset, const unsigned long length) -> void
+{
+	THROW_RUNTIME("[ERROR] Patched file can't be resized.");
+}
+
+auto PatchedFile::FileDescriptor(const long& offset, const size_t& length) -> int
+{
+	if (IsPatched(offset, length))
+		return -1;
+	return this->base->FileDescriptor(offset, length);
+}
+
+auto PatchedFile::Base() const -> std::shared_ptr<IRaw>
+{
+	return this->base;
+}
+
+auto PatchedFile::Patches() const -> const std::map<long, std::vector<byte>>&
+{
+	return this->patches;
+}
+
+auto PatchedFile::Revert() -> void
+{
+	// Only the patched bytes go back to the base data.
+	for (const auto& patch : this->patches)
+		Written(patch.first, patch.second.size());
+	this->patches.clear();
+	this->image.clear();
+	this->image.shrink_to_fit();
+	this->materialized = false;
+	auto block = this->base->ContiguousData();
+	Contiguous(block.Pointer, block.Length);
+}
+
+auto PatchedFile::IsPatched(const long& offset, const size_t& size) const -> bool
+{
+	if (this->patches.empty() || size == 0)
+		return false;
+
+	// The first patch starting after offset, or the one before it, are the only candidates.
+	auto next = this->patches.upper_bound(offset);
+	if (next != this->patches.end() && static_cast<size_t>(next->first - offset) < size)
+		return true;
+	if (next == this->patches.begin())
+		return false;
+	auto previous = std::prev(next);
+	return previous->first + static_cast<long>(previous->second.size()) > offset;
+}
+
+auto PatchedFile::ReadRange(const long& offset, const size_t& size) -> std::vector<byte>
+{
+	CheckRange(offset, size);
+	std::vector<byte> bytes(size);
+	ReadBytes(offset, bytes.data(), bytes.size());
+	return bytes;
+}
+
+auto PatchedFile::Overlay(const long& offset, byte* destination, const size_t& size) const -> void
+{
+	auto end = offset + static_cast<long>(size);
+	auto patch = this->patches.upper_bound(offset);
+	if (patch != this->patches.begin())
+		patch = std::prev(patch);
+	for (; patch != this->patches.end() && patch->first < end; ++patch)
+	{
+		auto patchEnd = patch->first + static_cast<long>(patch->second.size());
+		auto from = std::max(offset, patch->first);
+		auto to = std::min(end, patchEnd);
+		if (from >= to)
+			continue;
+		std::memcpy(destination + (from - offset), patch->second.data() + (from - patch->first),
+			static_cast<size_t>(to - from));
+	}
+}
+
+auto PatchedFile::Patch(const long& offset, const byte* bytes, const size_t& size) -> void
+{
+	CheckRange(offset, size);
+	auto begin = offset;
+	auto end = offset + static_cast<long>(size);
+
+	// Merge every patch which overlaps or touches the new one, so patches stay disjoint.
+	auto first = this->patches.upper_bound(offset);
+	if (first != this->patches.begin())
+	{
+		auto previous = std::prev(first);
+		if (previous->first + static_cast<long>(previous->second.size()) >= offset)
+			first = previous;
+	}
+	auto last = first;
+	for (; last != this->patches.end() && last->first <= end; ++last)
+	{
+		begin = std::min(begin, last->first);
+		end = std::max(end, last->first + static_cast<long>(last->second.size()));
+	}
+
+	std::vector<byte> merged(static_cast<size_t>(end - begin));
+	for (auto patch = first; patch != last; ++patch)
+		std::copy(patch->second.begin(), patch->second.end(), merged.begin() + (patch->first - begin));
+	std::copy(bytes, bytes + size, merged.begin() + (offset - begin));
+
+	this->patches.erase(first, last);
+	this->patches.emplace(begin, std::move(merged));
+	this->materialized = false;
+	Contiguous(nullptr, 0);
+	Written(offset, size);
+}
+
+auto PatchedFile::CheckRange(const long& offset, const size_t& size) -> void
+{
+	if (offset < 0 || static_cast<size_t>(offset) > Length() || size > Length() - offset)
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+}
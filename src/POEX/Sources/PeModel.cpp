@@ -0,0 +1,462 @@
+#include "../Headers/PeModel.h"
+#include <algorithm>
+#include <cstdint>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+PeModel::PeModel(const std::shared_ptr<IRaw>& bFile, const ParseMode& mode) :
+	// Most of the model is names and tables which grow with the file, so size the first block after it.
+	arena(new std::pmr::monotonic_buffer_resource(std::clamp<size_t>(bFile->Length() / 8, 0x1000, 0x100000))),
+	bFile(bFile), mode(mode),
+	dataDirectories(arena.get()), sections(arena.get()), importModules(arena.get()), importedFunctions(arena.get()),
+	exports(arena.get()), relocations(arena.get()), runtimeFunctions(arena.get()), tlsCallbacks(arena.get()),
+	diagnostics(arena.get())
+{
+	try
+	{
+		// Without headers there is nothing to resolve the directories with.
+		if (!ParseHeaders())
+			return;
+
+		ParseImports();
+		ParseExports();
+		ParseRelocations();
+		ParseRuntimeFunctions();
+		ParseTls();
+		ParseResources();
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto PeModel::Is64Bit() const -> bool
+{
+	return this->is64Bit;
+}
+
+auto PeModel::Machine() const -> unsigned short
+{
+	return this->machine;
+}
+
+auto PeModel::Characteristics() const -> unsigned short
+{
+	return this->characteristics;
+}
+
+auto PeModel::Subsystem() const -> unsigned short
+{
+	return this->subsystem;
+}
+
+auto PeModel::AddressOfEntryPoint() const -> unsigned int
+{
+	return this->addressOfEntryPoint;
+}
+
+auto PeModel::ImageBase() const -> unsigned long long
+{
+	return this->imageBase;
+}
+
+auto PeModel::DataDirectories() const -> const std::pmr::vector<DataDirectory>&
+{
+	return this->dataDirectories;
+}
+
+auto PeModel::Sections() const -> const std::pmr::vector<Section>&
+{
+	return this->sections;
+}
+
+auto PeModel::ImportModules() const -> const std::pmr::vector<ImportModule>&
+{
+	return this->importModules;
+}
+
+auto PeModel::ImportedFunctions() const -> const std::pmr::vector<ImportFunctionView>&
+{
+	return this->importedFunctions;
+}
+
+auto PeModel::Exports() const -> const std::pmr::vector<Export>&
+{
+	return this->exports;
+}
+
+auto PeModel::Relocations() const -> const std::pmr::vector<Relocation>&
+{
+	return this->relocations;
+}
+
+auto PeModel::RuntimeFunctions() const -> const std::pmr::vector<RuntimeFunction>&
+{
+	return this->runtimeFunctions;
+}
+
+auto PeModel::TlsCallbacks() const -> const std::pmr::vector<unsigned long long>&
+{
+	return this->tlsCallbacks;
+}
+
+auto PeModel::Resources() const -> const std::optional<ResourceTree>&
+{
+	return this->resources;
+}
+
+auto PeModel::Diagnostics() const -> const std::pmr::vector<Diagnostic>&
+{
+	return this->diagnostics;
+}
+
+auto PeModel::Fail(const ParseError& error, const std::optional<DataDirectoryType>& directory,
+	const unsigned long long& location) -> bool
+{
+	if (this->mode == ParseMode::Strict)
+	{
+		switch (error)
+		{
+		case ParseError::InvalidHeader: THROW_RUNTIME("[ERROR] PE header is wrong.");
+		case ParseError::RvaNotMapped: THROW_OUT_OF_RANGE("[ERROR] Section Not Found From RVA.");
+		default: THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
+		}
+	}
+
+	Diagnostic diagnostic;
+	diagnostic.Error = error;
+	diagnostic.Directory = directory;
+	diagnostic.Location = location;
+	this->diagnostics.push_back(diagnostic);
+	return false;
+}
+
+auto PeModel::Directory(const DataDirectoryType& type, long& offset) -> bool
+{
+	auto& directory = this->dataDirectories[static_cast<size_t>(type)];
+	if (directory.VirtualAddress == 0 || directory.Size == 0)
+		return false;
+	return Offset(directory.VirtualAddress, type, offset);
+}
+
+auto PeModel::Offset(const unsigned int& virtualAddress, const DataDirectoryType& type, long& offset) -> bool
+{
+	offset = this->sectionIndex->FindOffset(virtualAddress);
+	if (WRONG_LONG(offset))
+		return Fail(ParseError::RvaNotMapped, type, virtualAddress);
+	return true;
+}
+
+auto PeModel::Table(const long& offset, const size_t& count, const size_t& size, const DataDirectoryType& type) -> bool
+{
+	if (count > this->bFile->Length() / size || !this->bFile->InRange(offset, count * size))
+		return Fail(ParseError::OutOfRange, type, static_cast<unsigned long long>(offset));
+	return true;
+}
+
+auto PeModel::Keep(const std::string_view& text) -> std::string_view
+{
+	// Copied even when it is a view into the file data, a later write or reallocation of the data must not reach the model.
+	if (text.empty())
+		return text;
+
+	auto copy = static_cast<char*>(this->arena->allocate(text.size(), alignof(char)));
+	std::memcpy(copy, text.data(), text.size());
+	return std::string_view(copy, text.size());
+}
+
+auto PeModel::ViewAsciiString(const long& offset, const DataDirectoryType& type, std::string_view& text) -> bool
+{
+	if (!this->bFile->InRange(offset, sizeof(byte)))
+		return Fail(ParseError::OutOfRange, type, static_cast<unsigned long long>(offset));
+
+	std::string storage;
+	text = Keep(this->bFile->ViewAsciiString(offset, storage));
+	return true;
+}
+
+auto PeModel::ParseHeaders() -> bool
+{
+	if (!this->bFile->InRange(ELFANEW, sizeof(unsigned int)))
+		return Fail(ParseError::InvalidHeader, std::nullopt, ELFANEW);
+
+	auto ntHeaderOffset = static_cast<long>(this->bFile->Read<unsigned int>(ELFANEW));
+	auto optionalHeader = ntHeaderOffset + PE_SIGNATURE_UNTIL_MAGIC;
+	if (WRONG_LONG(ntHeaderOffset) || !this->bFile->InRange(optionalHeader, sizeof(unsigned short)))
+		return Fail(ParseError::InvalidHeader, std::nullopt, static_cast<unsigned long long>(ntHeaderOffset));
+
+	this->is64Bit = this->bFile->Read<unsigned short>(optionalHeader) == (unsigned short)FileType::BIT64;
+	auto dataDirectoryOffset = optionalHeader + (this->is64Bit ? 0x0070 : 0x0060);
+	if (!this->bFile->InRange(optionalHeader, dataDirectoryOffset - optionalHeader + 16 * sizeof(DataDirectory)))
+		return Fail(ParseError::InvalidHeader, std::nullopt, static_cast<unsigned long long>(optionalHeader));
+
+	this->machine = this->bFile->Read<unsigned short>(ntHeaderOffset + 0x0004);
+	this->characteristics = this->bFile->Read<unsigned short>(ntHeaderOffset + 0x0016);
+	this->addressOfEntryPoint = this->bFile->Read<unsigned int>(optionalHeader + 0x0010);
+	this->subsystem = this->bFile->Read<unsigned short>(optionalHeader + 0x0044);
+	this->imageBase = this->is64Bit ? this->bFile->Read<unsigned long long>(optionalHeader + 0x0018) :
+		this->bFile->Read<unsigned int>(optionalHeader + 0x001C);
+
+	auto raw = this->bFile->ReadArray<DataDirectory>(dataDirectoryOffset, 16);
+	this->dataDirectories.assign(raw.begin(), raw.end());
+
+	auto sectionTableOffset = optionalHeader + this->bFile->Read<unsigned short>(ntHeaderOffset + 0x0014);
+	return ParseSections(sectionTableOffset, this->bFile->Read<unsigned short>(ntHeaderOffset + 0x0006));
+}
+
+auto PeModel::ParseSections(const long& offset, const unsigned short& count) -> bool
+{
+	if (!this->bFile->InRange(offset, static_cast<size_t>(count) * SECTION_HEADER_SIZE))
+		return Fail(ParseError::InvalidHeader, std::nullopt, static_cast<unsigned long long>(offset));
+
+	this->sectionIndex = std::make_shared<const SectionIndex>(
+		std::make_shared<const SectionTable>(this->bFile, offset, count, this->imageBase));
+
+	auto& table = this->sectionIndex->Table();
+	this->sections.reserve(table.Count());
+	for (size_t i = 0; i < table.Count(); i++)
+	{
+		Section section;
+		std::string storage;
+		// The name is not null terminated when it is 8 characters long.
+		section.Name = Keep(this->bFile->ViewAsciiString(offset + static_cast<long>(i * SECTION_HEADER_SIZE), storage).substr(0, 8));
+		section.VirtualAddress = table.VirtualAddresses()[i];
+		section.VirtualSize = table.VirtualSizes()[i];
+		section.PointerToRawData = table.PointersToRawData()[i];
+		section.SizeOfRawData = table.SizesOfRawData()[i];
+		section.Characteristics = table.Characteristics()[i];
+		this->sections.push_back(section);
+	}
+	return true;
+}
+
+auto PeModel::ParseImports() -> void
+{
+	long offset;
+	auto& iat = this->dataDirectories[(size_t)DataDirectoryType::IAT];
+	if (iat.VirtualAddress == 0 || iat.Size == 0 || !Directory(DataDirectoryType::Import, offset))
+		return;
+
+	auto type = DataDirectoryType::Import;
+	auto sizeOfThunk = (unsigned int)(this->is64Bit ? IMAGE_THUNK_DATA_64 : IMAGE_THUNK_DATA_86);
+	auto ordinalBit = this->is64Bit ? ORDINAL_BIT_64 : ORDINAL_BIT_86;
+	auto ordinalMask = this->is64Bit ? ORDINAL_MASK_64 : ORDINAL_MASK_86;
+
+	for (long descriptor = offset;; descriptor += IMPORT_TABLE_SIZE)
+	{
+		if (!Table(descriptor, 1, IMPORT_TABLE_SIZE, type))
+			return;
+
+		auto importLookupTable = this->bFile->Read<unsigned int>(descriptor + 0x0000);
+		auto forwarderChain = this->bFile->Read<unsigned int>(descriptor + 0x0008);
+		auto name = this->bFile->Read<unsigned int>(descriptor + 0x000C);
+		auto importAddressTable = this->bFile->Read<unsigned int>(descriptor + 0x0010);
+
+		// Found the last ImageImportDescriptor which is completely null (except TimeDateStamp).
+		if (importLookupTable == 0 && forwarderChain == 0 && name == 0 && importAddressTable == 0)
+			return;
+
+		ImportModule module;
+		module.TimeDateStamp = this->bFile->Read<unsigned int>(descriptor + 0x0004);
+		module.FirstFunction = static_cast<unsigned int>(this->importedFunctions.size());
+
+		long nameOffset;
+		if (name != 0 && Offset(name, type, nameOffset))
+			ViewAsciiString(nameOffset, type, module.Dll);
+
+		long thunks;
+		auto thunkTable = importLookupTable != 0 ? importLookupTable : importAddressTable;
+		if (thunkTable != 0 && Offset(thunkTable, type, thunks))
+		{
+			// The thunk table is null terminated.
+			for (unsigned int i = 0;; i++)
+			{
+				auto thunk = thunks + static_cast<long>(i * sizeOfThunk);
+				if (!Table(thunk, 1, sizeOfThunk, type))
+					break;
+
+				auto addressOfData = this->is64Bit ? this->bFile->Read<unsigned long long>(thunk) :
+					static_cast<unsigned long long>(this->bFile->Read<unsigned int>(thunk));
+				if (addressOfData == 0)
+					break;
+
+				ImportFunctionView function;
+				function.Dll = module.Dll;
+				function.IATOffset = importAddressTable + i * sizeOfThunk - iat.VirtualAddress;
+				function.ByOrdinal = (addressOfData & ordinalBit) == ordinalBit;
+				if (function.ByOrdinal)
+					function.Hint = (unsigned short)(addressOfData & ordinalMask);
+				else
+				{
+					long hint;
+					if (!Offset(static_cast<unsigned int>(addressOfData), type, hint) || !Table(hint, 1, sizeof(unsigned short), type))
+						continue;
+					function.Hint = this->bFile->Read<unsigned short>(hint);
+					ViewAsciiString(hint + 0x0002, type, function.Name);
+				}
+				this->importedFunctions.push_back(function);
+			}
+		}
+
+		module.FunctionCount = static_cast<unsigned int>(this->importedFunctions.size()) - module.FirstFunction;
+		this->importModules.push_back(module);
+	}
+}
+
+auto PeModel::ParseExports() -> void
+{
+	long offset;
+	auto type = DataDirectoryType::Export;
+	if (!Directory(type, offset) || !Table(offset, 1, 0x0028, type))
+		return;
+
+	auto& exportDirectory = this->dataDirectories[(size_t)type];
+	auto base = this->bFile->Read<unsigned int>(offset + 0x0010);
+	auto numberOfFunctions = this->bFile->Read<unsigned int>(offset + 0x0014);
+	auto numberOfNames = this->bFile->Read<unsigned int>(offset + 0x0018);
+	auto addressOfFunctions = this->bFile->Read<unsigned int>(offset + 0x001C);
+	long functions, names, ordinals;
+	if (addressOfFunctions == 0 || !Offset(addressOfFunctions, type, functions) ||
+		!Table(functions, numberOfFunctions, sizeof(unsigned int), type))
+		return;
+
+	auto addresses = this->bFile->ReadArray<unsigned int>(functions, numberOfFunctions);
+	std::vector<unsigned int> nameAddresses;
+	std::vector<unsigned short> nameOrdinals;
+	if (numberOfNames != 0 &&
+		Offset(this->bFile->Read<unsigned int>(offset + 0x0020), type, names) && Table(names, numberOfNames, sizeof(unsigned int), type) &&
+		Offset(this->bFile->Read<unsigned int>(offset + 0x0024), type, ordinals) && Table(ordinals, numberOfNames, sizeof(unsigned short), type))
+	{
+		nameAddresses = this->bFile->ReadArray<unsigned int>(names, numberOfNames);
+		nameOrdinals = this->bFile->ReadArray<unsigned short>(ordinals, numberOfNames);
+	}
+
+	// Position of every ordinal in the export list, gaps are left out.
+	std::vector<unsigned int> positions(addresses.size(), UINT32_MAX);
+	this->exports.reserve(addresses.size());
+	for (unsigned int i = 0; i < addresses.size(); i++)
+	{
+		if (addresses[i] == 0)
+			continue;
+
+		Export exportFunction;
+		exportFunction.Address = addresses[i];
+		exportFunction.Ordinal = static_cast<unsigned short>(base + i);
+		long forwarder;
+		if (exportDirectory.VirtualAddress <= addresses[i] && addresses[i] < exportDirectory.VirtualAddress + exportDirectory.Size &&
+			Offset(addresses[i], type, forwarder))
+			ViewAsciiString(forwarder, type, exportFunction.ForwardedName);
+		positions[i] = static_cast<unsigned int>(this->exports.size());
+		this->exports.push_back(exportFunction);
+	}
+
+	for (size_t i = 0; i < nameAddresses.size(); i++)
+	{
+		long name;
+		if (nameOrdinals[i] >= positions.size() || positions[nameOrdinals[i]] == UINT32_MAX)
+			continue;
+		if (Offset(nameAddresses[i], type, name))
+			ViewAsciiString(name, type, this->exports[positions[nameOrdinals[i]]].Name);
+	}
+}
+
+auto PeModel::ParseRelocations() -> void
+{
+	long offset;
+	auto type = DataDirectoryType::BaseReloc;
+	if (!Directory(type, offset))
+		return;
+
+	size_t size = this->dataDirectories[(size_t)type].Size;
+	if (!Table(offset, size, 1, type))
+		size = this->bFile->Length() - std::min<size_t>(this->bFile->Length(), offset);
+
+	size_t position = 0;
+	while (size >= 8 && position <= size - 8)
+	{
+		auto block = offset + static_cast<long>(position);
+		auto virtualAddress = this->bFile->Read<unsigned int>(block);
+		auto sizeOfBlock = this->bFile->Read<unsigned int>(block + 0x0004);
+		if (sizeOfBlock < 8 || sizeOfBlock > size - position)
+		{
+			Fail(ParseError::OutOfRange, type, static_cast<unsigned long long>(block));
+			return;
+		}
+
+		auto entries = this->bFile->ReadArray<unsigned short>(block + 0x0008, (sizeOfBlock - 8) / 2);
+		for (auto entry : entries)
+		{
+			// IMAGE_REL_BASED_ABSOLUTE only pads the block
+			if ((entry >> 12) == 0)
+				continue;
+			Relocation relocation;
+			relocation.VirtualAddress = virtualAddress + (entry & 0x0FFF);
+			relocation.Type = static_cast<unsigned short>(entry >> 12);
+			this->relocations.push_back(relocation);
+		}
+		position += sizeOfBlock;
+	}
+}
+
+auto PeModel::ParseRuntimeFunctions() -> void
+{
+	long offset;
+	auto type = DataDirectoryType::Exception;
+	// Only x64 uses the 12 byte RUNTIME_FUNCTION, ARM64 .pdata entries have another layout.
+	if (this->machine != static_cast<unsigned short>(MachineType::Amd64) || !Directory(type, offset))
+		return;
+
+	auto count = this->dataDirectories[(size_t)type].Size / sizeof(RuntimeFunction);
+	if (!Table(offset, count, sizeof(RuntimeFunction), type))
+		return;
+
+	auto functions = this->bFile->ReadArray<RuntimeFunction>(offset, count);
+	this->runtimeFunctions.assign(functions.begin(), functions.end());
+}
+
+auto PeModel::ParseTls() -> void
+{
+	long offset;
+	auto type = DataDirectoryType::TLS;
+	if (!Directory(type, offset) || !Table(offset, 1, this->is64Bit ? 0x0020 : 0x0010, type))
+		return;
+
+	auto addressOfCallBacks = this->is64Bit ? this->bFile->Read<unsigned long long>(offset + 0x0018) :
+		this->bFile->Read<unsigned int>(offset + 0x000C);
+	long callbacks;
+	if (addressOfCallBacks == 0 || !Offset(static_cast<unsigned int>(addressOfCallBacks - this->imageBase), type, callbacks))
+		return;
+
+	// The callback array is null terminated.
+	auto size = this->is64Bit ? sizeof(unsigned long long) : sizeof(unsigned int);
+	for (long callback = callbacks;; callback += static_cast<long>(size))
+	{
+		if (!Table(callback, 1, size, type))
+			return;
+		auto address = this->is64Bit ? this->bFile->Read<unsigned long long>(callback) :
+			this->bFile->Read<unsigned int>(callback);
+		if (address == 0)
+			return;
+		this->tlsCallbacks.push_back(address);
+	}
+}
+
+auto PeModel::ParseResources() -> void
+{
+	long offset;
+	auto type = DataDirectoryType::Resource;
+	if (!Directory(type, offset))
+		return;
+
+	// The tree stays inside the data on its own, a directory which runs past it is reported and cut.
+	auto size = this->dataDirectories[(size_t)type].Size;
+	if (!Table(offset, size, 1, type) && !this->bFile->InRange(offset, 0))
+		return;
+
+	this->resources.emplace(this->bFile, offset, size, this->arena.get());
+}
@@ -0,0 +1,213 @@
+#include "../Headers/ResourceTree.h"
+#include <unordered_set>
+#include <algorithm>
+#include <cwctype>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+namespace
+{
+	const unsigned int resourceDirectorySize = 0x0010;
+	const unsigned int resourceEntrySize = 0x0008;
+	const unsigned int resourceDataEntrySize = 0x0010;
+	const unsigned int highBit = 0x80000000;
+	// Type, name and language, a directory below the language level isn't expanded.
+	const unsigned short maxDepth = 3;
+
+	// Resource compilers store names upper-cased and the loader looks them up ignoring case.
+	auto CompareIgnoringCase(const std::wstring_view& left, const std::wstring_view& right) -> int
+	{
+		auto count = std::min(left.size(), right.size());
+		for (size_t i = 0; i < count; i++)
+		{
+			auto a = std::towupper(left[i]), b = std::towupper(right[i]);
+			if (a != b)
+				return a < b ? -1 : 1;
+		}
+		return left.size() == right.size() ? 0 : left.size() < right.size() ? -1 : 1;
+	}
+}
+
+ResourceId::ResourceId(const unsigned int& id) : Id(id)
+{
+}
+
+ResourceId::ResourceId(const std::wstring_view& name) : Name(name), IsNamed(true)
+{
+}
+
+ResourceId::ResourceId(const wchar_t* name) : ResourceId(std::wstring_view(name))
+{
+}
+
+ResourceTree::ResourceTree(const std::shared_ptr<IRaw>& bFile, const long& offset, const unsigned int& length,
+	std::pmr::memory_resource* memoryResource) : nodes(memoryResource), names(memoryResource), offset(offset)
+{
+	if (WRONG_LONG(this->offset))
+		THROW_EXCEPTION("[ERROR] offset value is wrong.");
+
+	try
+	{
+		// Never read past the data, whatever the directory size claims.
+		auto available = static_cast<size_t>(this->offset) < bFile->Length() ? bFile->Length() - this->offset : 0;
+		Decode(bFile, static_cast<unsigned int>(std::min<size_t>(length, available)));
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto ResourceTree::Nodes() const -> const std::pmr::vector<ResourceNode>&
+{
+	return this->nodes;
+}
+
+auto ResourceTree::Name(const ResourceNode& node) const -> std::wstring_view
+{
+	return std::wstring_view(this->names.data() + node.NameIndex, node.NameLength);
+}
+
+auto ResourceTree::Offset() const -> long
+{
+	return this->offset;
+}
+
+auto ResourceTree::FindChild(const ResourceNode& directory, const ResourceId& id) const -> const ResourceNode*
+{
+	if (directory.IsData || directory.ChildCount == 0)
+		return nullptr;
+
+	auto first = this->nodes.begin() + directory.FirstChild;
+	auto last = first + directory.ChildCount;
+	auto ids = std::partition_point(first, last, [](const ResourceNode& node) { return node.IsNamed; });
+
+	if (id.IsNamed)
+	{
+		auto it = std::lower_bound(first, ids, id.Name,
+			[this](const ResourceNode& node, const std::wstring_view& name) { return CompareIgnoringCase(Name(node), name) < 0; });
+		return it != ids && CompareIgnoringCase(Name(*it), id.Name) == 0 ? &*it : nullptr;
+	}
+
+	auto it = std::lower_bound(ids, last, id.Id,
+		[](const ResourceNode& node, const unsigned int& value) { return node.Id < value; });
+	return it != last && it->Id == id.Id ? &*it : nullptr;
+}
+
+auto ResourceTree::Find(const ResourceId& type, const ResourceId& name,
+	const std::optional<unsigned int>& language) const -> const ResourceNode*
+{
+	auto typeNode = FindChild(this->nodes.front(), type);
+	if (typeNode == nullptr)
+		return nullptr;
+
+	auto nameNode = FindChild(*typeNode, name);
+	if (nameNode == nullptr || nameNode->IsData || nameNode->ChildCount == 0)
+		return nullptr;
+
+	auto languageNode = language.has_value() ? FindChild(*nameNode, language.value()) :
+		&this->nodes[nameNode->FirstChild];
+	return languageNode != nullptr && languageNode->IsData ? languageNode : nullptr;
+}
+
+auto ResourceTree::DataEntries() const -> std::vector<ResourceEntry>
+{
+	std::vector<ResourceEntry> entries;
+	for (const auto& node : this->nodes)
+	{
+		if (!node.IsData)
+			continue;
+
+		// Walk up to the type level, the path is at most three nodes long in a well formed tree.
+		ResourceEntry entry;
+		entry.Data = &node;
+		for (auto current = &node; current->Depth > 0; current = &this->nodes[current->Parent])
+		{
+			auto id = current->IsNamed ? ResourceId(Name(*current)) : ResourceId(current->Id);
+			if (current->Depth == 1)
+				entry.Type = id;
+			else if (current->Depth == 2)
+				entry.Name = id;
+			else if (current->Depth == 3)
+				entry.Language = current->Id;
+		}
+		entries.push_back(entry);
+	}
+	return entries;
+}
+
+auto ResourceTree::Decode(const std::shared_ptr<IRaw>& bFile, const unsigned int& length) -> void
+{
+	// The node array is its own work queue: every directory is expanded once, in breadth-first order.
+	this->nodes.push_back(ResourceNode());
+	std::unordered_set<unsigned int> expanded;
+
+	// Every entry and name character of a well formed tree takes its own bytes of the directory, so
+	// directories which share their entries can't make the tree grow past the size of the data.
+	auto maxNodes = static_cast<size_t>(length / resourceEntrySize) + 1;
+	auto maxNames = static_cast<size_t>(length / sizeof(unsigned short));
+
+	for (size_t i = 0; i < this->nodes.size(); i++)
+	{
+		if (this->nodes[i].IsData || this->nodes[i].Depth >= maxDepth)
+			continue;
+
+		// Skip directories which are out of the resource directory or were already expanded (loops).
+		auto directory = this->nodes[i].Offset;
+		if (directory > length || length - directory < resourceDirectorySize || !expanded.insert(directory).second)
+			continue;
+
+		auto directoryOffset = this->offset + static_cast<long>(directory);
+		auto count = static_cast<unsigned int>(bFile->Read<unsigned short>(directoryOffset + 0x000C)) +
+			bFile->Read<unsigned short>(directoryOffset + 0x000E);
+		count = std::min(count, (length - directory - resourceDirectorySize) / resourceEntrySize);
+		count = static_cast<unsigned int>(std::min<size_t>(count, maxNodes - this->nodes.size()));
+
+		auto depth = static_cast<unsigned short>(this->nodes[i].Depth + 1);
+		this->nodes[i].FirstChild = static_cast<unsigned int>(this->nodes.size());
+		this->nodes[i].ChildCount = count;
+
+		for (unsigned int e = 0; e < count; e++)
+		{
+			auto entryOffset = directoryOffset + static_cast<long>(resourceDirectorySize + e * resourceEntrySize);
+			auto name = bFile->Read<unsigned int>(entryOffset);
+			auto offsetToData = bFile->Read<unsigned int>(entryOffset + 0x0004);
+
+			ResourceNode node;
+			node.Parent = static_cast<unsigned int>(i);
+			node.Depth = depth;
+			node.IsNamed = (name & highBit) != 0;
+			node.IsData = (offsetToData & highBit) == 0;
+			node.Offset = offsetToData & ~highBit;
+
+			auto nameEntry = name & ~highBit;
+			if (node.IsNamed && nameEntry < length && length - nameEntry >= sizeof(unsigned short))
+			{
+				// IMAGE_RESOURCE_DIR_STRING_U, a counted UTF-16 string
+				auto nameOffset = this->offset + static_cast<long>(nameEntry);
+				auto nameLength = std::min<unsigned int>(bFile->Read<unsigned short>(nameOffset),
+					(length - nameEntry - sizeof(unsigned short)) / 2);
+				nameLength = static_cast<unsigned int>(std::min<size_t>(nameLength, maxNames - this->names.size()));
+				node.NameIndex = static_cast<unsigned int>(this->names.size());
+				node.NameLength = nameLength;
+				for (unsigned int c = 0; c < nameLength; c++)
+					this->names.push_back(static_cast<wchar_t>(bFile->Read<unsigned short>(nameOffset + 2 + c * 2)));
+			}
+			else if (!node.IsNamed)
+				node.Id = name;
+
+			if (node.IsData && node.Offset <= length && length - node.Offset >= resourceDataEntrySize)
+			{
+				auto dataOffset = this->offset + static_cast<long>(node.Offset);
+				node.DataRva = bFile->Read<unsigned int>(dataOffset);
+				node.DataSize = bFile->Read<unsigned int>(dataOffset + 0x0004);
+				node.CodePage = bFile->Read<unsigned int>(dataOffset + 0x0008);
+			}
+			this->nodes.push_back(node);
+		}
+	}
+}
@@ -0,0 +1,190 @@
+#include "../Headers/RuntimeFunctionIndex.h"
+#include <algorithm>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+namespace
+{
+	const unsigned char handlerFlags = 0x03;
+	const unsigned char chainInfoFlag = 0x04;
+
+	// Low bit of UnwindInfoAddress, the entry then refers to another RUNTIME_FUNCTION.
+	const unsigned int indirectFlag = 0x00000001;
+
+	// Chains are short in practice, the limit only stops loops in malformed files.
+	const size_t maxChainLength = 32;
+
+	/// <summary>
+	/// Number of UNWIND_CODE slots an operation uses.
+	/// </summary>
+	auto Slots(const UnwindOperation& operation, const unsigned char& operationInfo) -> unsigned int
+	{
+		switch (operation)
+		{
+		case UnwindOperation::AllocLarge:
+			return operationInfo == 0 ? 2 : 3;
+		case UnwindOperation::SaveNonVolatile:
+		case UnwindOperation::SaveXmm128:
+		case UnwindOperation::Epilog:
+			return 2;
+		case UnwindOperation::SaveNonVolatileFar:
+		case UnwindOperation::SaveXmm128Far:
+		case UnwindOperation::SpareCode:
+			return 3;
+		default:
+			return 1;
+		}
+	}
+}
+
+RuntimeFunctionIndex::RuntimeFunctionIndex(const std::shared_ptr<IRaw>& bFile,
+	const std::shared_ptr<const SectionIndex>& sectionIndex, std::vector<RuntimeFunction> functions) :
+	bFile(bFile), sectionIndex(sectionIndex), functions(std::move(functions))
+{
+	// The exception directory is sorted by the linker, only malformed files need the sort.
+	auto byBegin = [](const RuntimeFunction& first, const RuntimeFunction& second) {
+		return first.BeginAddress < second.BeginAddress;
+	};
+	if (!std::is_sorted(this->functions.begin(), this->functions.end(), byBegin))
+		std::sort(this->functions.begin(), this->functions.end(), byBegin);
+}
+
+auto RuntimeFunctionIndex::FindFunction(const unsigned int& virtualAddress) const -> const RuntimeFunction*
+{
+	auto it = std::upper_bound(this->functions.begin(), this->functions.end(), virtualAddress,
+		[](const unsigned int& value, const RuntimeFunction& function) { return value < function.BeginAddress; });
+	if (it == this->functions.begin())
+		return nullptr;
+
+	--it;
+	return virtualAddress < it->EndAddress ? &*it : nullptr;
+}
+
+auto RuntimeFunctionIndex::Unwind(const RuntimeFunction& function) const -> std::optional<UnwindInfo>
+{
+	try
+	{
+		auto address = function.UnwindInfoAddress;
+		if ((address & indirectFlag) != 0)
+		{
+			auto offset = this->sectionIndex->FindOffset(address & ~indirectFlag);
+			if (offset < 0 || !this->bFile->InRange(offset, sizeof(RuntimeFunction)))
+				return std::nullopt;
+			address = this->bFile->Read<RuntimeFunction>(offset).UnwindInfoAddress;
+			if ((address & indirectFlag) != 0)
+				return std::nullopt;
+		}
+		return Decode(address);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto RuntimeFunctionIndex::UnwindChain(const RuntimeFunction& function) const -> std::vector<UnwindInfo>
+{
+	try
+	{
+		std::vector<UnwindInfo> chain;
+		auto info = Unwind(function);
+		while (info.has_value() && chain.size() < maxChainLength)
+		{
+			chain.push_back(std::move(info.value()));
+			if (!chain.back().Chained.has_value())
+				break;
+			info = Unwind(chain.back().Chained.value());
+		}
+		return chain;
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto RuntimeFunctionIndex::Functions() const -> const std::vector<RuntimeFunction>&
+{
+	return this->functions;
+}
+
+auto RuntimeFunctionIndex::Decode(const unsigned int& address) const -> std::optional<UnwindInfo>
+{
+	auto offset = this->sectionIndex->FindOffset(address);
+	if (offset < 0 || !this->bFile->InRange(offset, 4))
+		return std::nullopt;
+
+	UnwindInfo info;
+	info.Address = address;
+	auto header = this->bFile->Read<unsigned int>(offset);
+	info.Version = static_cast<unsigned char>(header & 0x07);
+	info.Flags = static_cast<unsigned char>((header >> 3) & 0x1F);
+	info.SizeOfProlog = static_cast<unsigned char>(header >> 8);
+	info.FrameRegister = static_cast<unsigned char>((header >> 24) & 0x0F);
+	info.FrameOffset = static_cast<unsigned char>(header >> 28);
+	if (info.Version != 1 && info.Version != 2)
+		return std::nullopt;
+
+	unsigned int count = static_cast<unsigned char>(header >> 16);
+	if (!this->bFile->InRange(offset + 4, count * 2))
+		return std::nullopt;
+
+	// The whole code array is read at once, operations with operands use the following slots.
+	auto slots = this->bFile->ReadArray<unsigned short>(offset + 4, count);
+	for (unsigned int i = 0; i < count;)
+	{
+		UnwindCode code;
+		code.CodeOffset = static_cast<unsigned char>(slots[i]);
+		code.Operation = static_cast<UnwindOperation>((slots[i] >> 8) & 0x0F);
+		code.OperationInfo = static_cast<unsigned char>(slots[i] >> 12);
+
+		auto used = Slots(code.Operation, code.OperationInfo);
+		if (used > count - i)
+			return std::nullopt;
+
+		switch (code.Operation)
+		{
+		case UnwindOperation::AllocLarge:
+			code.Operand = code.OperationInfo == 0 ? slots[i + 1] * 8u :
+				slots[i + 1] | (static_cast<unsigned int>(slots[i + 2]) << 16);
+			break;
+		case UnwindOperation::AllocSmall:
+			code.Operand = code.OperationInfo * 8u + 8u;
+			break;
+		case UnwindOperation::SaveNonVolatile:
+			code.Operand = slots[i + 1] * 8u;
+			break;
+		case UnwindOperation::SaveXmm128:
+			code.Operand = slots[i + 1] * 16u;
+			break;
+		case UnwindOperation::SaveNonVolatileFar:
+		case UnwindOperation::SaveXmm128Far:
+			code.Operand = slots[i + 1] | (static_cast<unsigned int>(slots[i + 2]) << 16);
+			break;
+		default:
+			break;
+		}
+		info.Codes.push_back(code);
+		i += used;
+	}
+
+	// The code array is padded to an even number of slots, the handler or the chained function follows.
+	auto trailer = offset + 4 + static_cast<long>(((count + 1) & ~1u) * 2);
+	if ((info.Flags & chainInfoFlag) != 0)
+	{
+		if (!this->bFile->InRange(trailer, sizeof(RuntimeFunction)))
+			return std::nullopt;
+		info.Chained = this->bFile->Read<RuntimeFunction>(trailer);
+	}
+	else if ((info.Flags & handlerFlags) != 0)
+	{
+		if (!this->bFile->InRange(trailer, 4))
+			return std::nullopt;
+		info.ExceptionHandler = this->bFile->Read<unsigned int>(trailer);
+	}
+	return info;
+}
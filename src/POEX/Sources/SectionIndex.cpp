@@ -0,0 +1,135 @@
+#include "../Headers/SectionIndex.h"
+#include <algorithm>
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+SectionIndex::SectionIndex(const std::shared_ptr<const SectionTable>& sectionTable) : sectionTable(sectionTable)
+{
+	try
+	{
+		if (this->sectionTable == nullptr)
+			THROW_OUT_OF_RANGE("[ERROR] Section Header can not be empty.");
+
+		auto& virtualAddresses = this->sectionTable->VirtualAddresses();
+		auto& virtualSizes = this->sectionTable->VirtualSizes();
+		this->sorted.resize(virtualAddresses.size());
+		for (unsigned int i = 0; i < this->sorted.size(); i++)
+			this->sorted[i] = i;
+		std::stable_sort(this->sorted.begin(), this->sorted.end(), [&](const unsigned int& first, const unsigned int& second)
+			{
+				return virtualAddresses[first] < virtualAddresses[second];
+			});
+
+		// Malformed files can have overlapping sections, the first one in table order wins there.
+		for (size_t i = 1; i < this->sorted.size(); i++)
+		{
+			auto previous = this->sorted[i - 1];
+			if (static_cast<unsigned long long>(virtualAddresses[previous]) + virtualSizes[previous] > virtualAddresses[this->sorted[i]])
+				this->overlapping = true;
+		}
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+SectionIndex::SectionIndex(const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders) :
+	SectionIndex(std::make_shared<const SectionTable>(sectionHeaders))
+{
+}
+
+auto SectionIndex::Find(const unsigned int& virtualAddress) const -> long
+{
+	auto count = static_cast<unsigned int>(this->sorted.size());
+	if (!this->overlapping)
+	{
+		auto hint = this->lastHit.load(std::memory_order_relaxed);
+		if (hint < count && Contains(hint, virtualAddress))
+			return hint;
+
+		auto& virtualAddresses = this->sectionTable->VirtualAddresses();
+		auto next = std::upper_bound(this->sorted.begin(), this->sorted.end(), virtualAddress,
+			[&](const unsigned int& address, const unsigned int& index) { return address < virtualAddresses[index]; });
+		if (next != this->sorted.begin() && Contains(*std::prev(next), virtualAddress))
+		{
+			this->lastHit.store(*std::prev(next), std::memory_order_relaxed);
+			return *std::prev(next);
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < count; i++)
+			if (Contains(i, virtualAddress))
+				return i;
+	}
+
+	// An address right at the end of a section still belongs to it, the last such section wins.
+	for (auto i = count; i > 0; i--)
+		if (Contains(i - 1, virtualAddress, true))
+			return static_cast<long>(i - 1);
+	return -1;
+}
+
+auto SectionIndex::FindOffset(const unsigned int& virtualAddress) const -> long
+{
+	auto index = Find(virtualAddress);
+	if (index < 0)
+		return -1;
+	return static_cast<long>(virtualAddress - this->sectionTable->VirtualAddresses()[index] +
+		this->sectionTable->PointersToRawData()[index]);
+}
+
+auto SectionIndex::RvaToOffset(const unsigned int& virtualAddress) const -> unsigned int
+{
+	try
+	{
+		if (this->sorted.empty())
+			THROW_OUT_OF_RANGE("[ERROR] Section Header can not be empty.");
+
+		auto index = Find(virtualAddress);
+		if (index < 0)
+			THROW_EXCEPTION("[ERROR] Section Not Found From RVA.");
+
+		return virtualAddress - this->sectionTable->VirtualAddresses()[index] + this->sectionTable->PointersToRawData()[index];
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto SectionIndex::VaToOffset(const unsigned long long& virtualAddress) const -> unsigned long
+{
+	try
+	{
+		if (this->sorted.empty())
+			THROW_OUT_OF_RANGE("[ERROR] Section Header can not be empty.");
+		return RvaToOffset(static_cast<unsigned int>(virtualAddress - this->sectionTable->ImageBaseAddress()));
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto SectionIndex::ImageBaseAddress() const -> unsigned long long
+{
+	return this->sectionTable->ImageBaseAddress();
+}
+
+auto SectionIndex::Table() const -> const SectionTable&
+{
+	return *this->sectionTable;
+}
+
+auto SectionIndex::Contains(const unsigned int& index, const unsigned int& virtualAddress, const bool& inclusive) const -> bool
+{
+	auto begin = this->sectionTable->VirtualAddresses()[index];
+	auto end = static_cast<unsigned long long>(begin) + this->sectionTable->VirtualSizes()[index];
+	return virtualAddress >= begin && (virtualAddress < end || (inclusive && virtualAddress == end));
+}
@@ -0,0 +1,125 @@
+#include "../Headers/SectionTable.h"
+
+/**
+* Portable Executable (POEX) Project
+* Developed by AFP33, 2023
+* Url: https://github.com/AFP33/POEX
+*/
+
+namespace
+{
+	/// <summary>
+	/// IMAGE_SECTION_HEADER as it is stored in the file
+	/// </summary>
+	struct RawSectionHeader
+	{
+		byte Name[8];
+		unsigned int VirtualSize;
+		unsigned int VirtualAddress;
+		unsigned int SizeOfRawData;
+		unsigned int PointerToRawData;
+		unsigned int PointerToRelocations;
+		unsigned int PointerToLinenumbers;
+		unsigned short NumberOfRelocations;
+		unsigned short NumberOfLinenumbers;
+		unsigned int Characteristics;
+	};
+	static_assert(sizeof(RawSectionHeader) == SECTION_HEADER_SIZE, "RawSectionHeader must match IMAGE_SECTION_HEADER");
+}
+
+SectionTable::SectionTable(const std::shared_ptr<IRaw>& bFile, const long& offset, const unsigned short& numberOfSections,
+	const unsigned long long& imageBaseAddress) : imageBaseAddress(imageBaseAddress), offset(offset)
+{
+	try
+	{
+		if (WRONG_LONG(this->offset))
+			THROW_EXCEPTION("[ERROR] offset value is wrong.");
+
+		auto headers = bFile->ReadArray<RawSectionHeader>(offset, numberOfSections);
+		Reserve(headers.size());
+		for (auto& header : headers)
+		{
+			this->virtualAddresses.push_back(header.VirtualAddress);
+			this->virtualSizes.push_back(header.VirtualSize);
+			this->pointersToRawData.push_back(header.PointerToRawData);
+			this->sizesOfRawData.push_back(header.SizeOfRawData);
+			this->characteristics.push_back(header.Characteristics);
+		}
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+SectionTable::SectionTable(const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders)
+{
+	try
+	{
+		if (!sectionHeaders.empty())
+			this->imageBaseAddress = sectionHeaders.front()->ImageBaseAddress();
+
+		Reserve(sectionHeaders.size());
+		for (auto& sectionHeader : sectionHeaders)
+		{
+			this->virtualAddresses.push_back(sectionHeader->VirtualAddress());
+			this->virtualSizes.push_back(sectionHeader->VirtualSize());
+			this->pointersToRawData.push_back(sectionHeader->PointerToRawData());
+			this->sizesOfRawData.push_back(sectionHeader->SizeOfRawData());
+			this->characteristics.push_back(static_cast<unsigned int>(sectionHeader->Characteristics()));
+		}
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
+
+auto SectionTable::Count() const -> size_t
+{
+	return this->virtualAddresses.size();
+}
+
+auto SectionTable::ImageBaseAddress() const -> unsigned long long
+{
+	return this->imageBaseAddress;
+}
+
+auto SectionTable::Offset() const -> long
+{
+	return this->offset;
+}
+
+auto SectionTable::VirtualAddresses() const -> const std::vector<unsigned int>&
+{
+	return this->virtualAddresses;
+}
+
+auto SectionTable::VirtualSizes() const -> const std::vector<unsigned int>&
+{
+	return this->virtualSizes;
+}
+
+auto SectionTable::PointersToRawData() const -> const std::vector<unsigned int>&
+{
+	return this->pointersToRawData;
+}
+
+auto SectionTable::SizesOfRawData() const -> const std::vector<unsigned int>&
+{
+	return this->sizesOfRawData;
+}
+
+auto SectionTable::Characteristics() const -> const std::vector<unsigned int>&
+{
+	return this->characteristics;
+}
+
+auto SectionTable::Reserve(const size_t& count) -> void
+{
+	this->virtualAddresses.reserve(count);
+	this->virtualSizes.reserve(count);
+	this->pointersToRawData.reserve(count);
+	this->sizesOfRawData.reserve(count);
+	this->characteristics.reserve(count);
+}
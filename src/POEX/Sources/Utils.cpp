@@ -1,17 +1,144 @@
 #include "../Headers/Utils.h"
-#include <functional>
+#include "../Headers/SectionIndex.h"
+#include <algorithm>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace
+{
+	// Largest amount copied or written by one call.
+	const size_t chunkSize = 0x00100000;
+
+#ifndef _WIN32
+	/// <summary>
+	/// Copy a range from one file to another inside the kernel, copy_file_range first and sendfile
+	/// when the file systems don't support it.
+	/// </summary>
+	/// <returns>Number of bytes copied, the rest has to be written from memory</returns>
+	auto CopyInKernel(const int& input, const long& offset, const size_t& length, const int& output) -> size_t
+	{
+		if (input < 0)
+			return 0;
+
+		size_t done = 0;
+		auto useSendFile = false;
+		while (done < length)
+		{
+			auto position = static_cast<off_t>(offset + done);
+			auto size = std::min(length - done, chunkSize);
+			auto count = useSendFile ? sendfile(output, input, &position, size) :
+				copy_file_range(input, &position, output, nullptr, size, 0);
+			if (count > 0)
+			{
+				done += static_cast<size_t>(count);
+				continue;
+			}
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count < 0 && !useSendFile && (errno == EXDEV || errno == EINVAL || errno == ENOSYS ||
+				errno == EOPNOTSUPP || errno == EBADF))
+			{
+				useSendFile = true;
+				continue;
+			}
+			break;
+		}
+		return done;
+	}
+#endif
+
+	/// <summary>
+	/// Pass a range of the data to function in chunks, without materializing non-contiguous backends.
+	/// </summary>
+	template <typename Function>
+	auto ForEachChunk(const std::shared_ptr<IRaw>& bFile, const long& offset, const size_t& length,
+		const Function& function) -> void
+	{
+		auto block = bFile->ContiguousData();
+		std::vector<byte> buffer;
+		for (size_t done = 0; done < length;)
+		{
+			auto size = std::min(length - done, chunkSize);
+			auto bytes = static_cast<const byte*>(nullptr);
+			if (!block.empty())
+				bytes = block.Pointer + offset + done;
+			else
+			{
+				buffer.resize(size);
+				bFile->ReadBytes(offset + static_cast<long>(done), buffer.data(), size);
+				bytes = buffer.data();
+			}
+			function(bytes, size, done);
+			done += size;
+		}
+	}
+
+#ifdef _WIN32
+	/// <summary>
+	/// Write a range of the data at position of output.
+	/// </summary>
+	auto WriteRange(const std::shared_ptr<IRaw>& bFile, const long& offset, const size_t& length,
+		std::ostream& output, const size_t& position) -> void
+	{
+		output.seekp(static_cast<std::streamoff>(position));
+		ForEachChunk(bFile, offset, length, [&output](const byte* bytes, const size_t& size, const size_t&)
+		{
+			if (!output.write(reinterpret_cast<const char*>(bytes), size))
+				THROW_RUNTIME("[ERROR] Writing file fail.");
+		});
+	}
+#else
+	/// <summary>
+	/// Write a range of the data at position of output. When input holds the same bytes at offset
+	/// they are copied inside the kernel, whatever it didn't copy is written from the data.
+	/// </summary>
+	auto WriteRange(const std::shared_ptr<IRaw>& bFile, const int& input, const long& offset, const size_t& length,
+		const int& output, const size_t& position) -> void
+	{
+		size_t done = 0;
+		if (input >= 0)
+		{
+			// copy_file_range and sendfile write at the file position of output.
+			if (lseek(output, static_cast<off_t>(position), SEEK_SET) < 0)
+				THROW_RUNTIME("[ERROR] Writing file fail.");
+			done = CopyInKernel(input, offset, length, output);
+		}
+
+		ForEachChunk(bFile, offset + static_cast<long>(done), length - done,
+			[output, &position, &done](const byte* bytes, const size_t& size, const size_t& at)
+		{
+			for (size_t written = 0; written < size;)
+			{
+				auto count = pwrite(output, bytes + written, size - written,
+					static_cast<off_t>(position + done + at + written));
+				if (count < 0 && errno == EINTR)
+					continue;
+				if (count <= 0)
+					THROW_RUNTIME("[ERROR] Writing file fail.");
+				written += static_cast<size_t>(count);
+			}
+		});
+	}
+#endif
+}
 
 auto Utils::VaToOffset(const unsigned long& virtualAddress, const std::vector<std::shared_ptr<ImageSectionHeader>>& sectionHeaders) -> unsigned long
 {
 	try
 	{
-		auto firstObj = sectionHeaders.front();
-		auto rva = virtualAddress - firstObj->ImageBaseAddress();
-		return Utils::RvaToOffset(rva, sectionHeaders);
+		return SectionIndex(sectionHeaders).VaToOffset(virtualAddress);
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		throw;
 	}
 }
 
@@ -19,29 +146,196 @@ auto Utils::RvaToOffset(const unsigned int& virtualAddress, const std::vector<st
 {
 	try
 	{
-		if (sectionHeaders.size() == 0)
-			THROW_OUT_OF_RANGE("[ERROR] Section Header can not be empty.");
+		return SectionIndex(sectionHeaders).RvaToOffset(virtualAddress);
+	}
+	catch (const std::exception&)
+	{
+		throw;
+	}
+}
 
-		std::function<std::shared_ptr<ImageSectionHeader>(std::vector<std::shared_ptr<ImageSectionHeader>>, unsigned long)> FindSectionFromRva =
-			[&](std::vector<std::shared_ptr<ImageSectionHeader>> sectionHeaders, unsigned long relVirtualAddress)
-		{
-			for (auto imageSectionHeader : sectionHeaders)
-				if (relVirtualAddress >= imageSectionHeader->VirtualAddress() && relVirtualAddress < imageSectionHeader->VirtualAddress() + imageSectionHeader->VirtualSize())
-					return imageSectionHeader;
+auto Utils::CopyToFile(const std::shared_ptr<IRaw>& bFile, const long& offset, const size_t& length,
+	const std::filesystem::path& filepath) -> void
+{
+	if (!bFile->InRange(offset, length))
+		THROW_OUT_OF_RANGE("[ERROR] offset value is wrong.");
 
-			for (auto i = sectionHeaders.size() - 1; i >= 0; i--)
-				if (relVirtualAddress >= sectionHeaders[i]->VirtualAddress() && relVirtualAddress <= sectionHeaders[i]->VirtualAddress() + sectionHeaders[i]->VirtualSize())
-					return sectionHeaders[i];
+#ifdef _WIN32
+	std::ofstream output(filepath, std::ios::binary | std::ios::trunc);
+	if (!output)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	WriteRange(bFile, offset, length, output, 0);
+#else
+	auto output = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (output < 0)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
 
-			THROW_EXCEPTION("[ERROR] Section Not Found From RVA.");
-		};
+	try
+	{
+		WriteRange(bFile, bFile->FileDescriptor(offset, length), offset, length, output, 0);
+	}
+	catch (const std::exception&)
+	{
+		close(output);
+		throw;
+	}
 
-		auto section = FindSectionFromRva(sectionHeaders, virtualAddress);
+	if (close(output) != 0)
+		THROW_RUNTIME("[ERROR] Writing file fail.");
+#endif
+}
+
+auto Utils::WriteDirtyRanges(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath) -> void
+{
+#ifdef _WIN32
+	std::fstream output(filepath, std::ios::binary | std::ios::in | std::ios::out);
+	if (!output)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	output.seekp(0, std::ios::end);
+	if (static_cast<size_t>(output.tellp()) != bFile->Length())
+		THROW_RUNTIME("[ERROR] File size has changed.");
+	for (const auto& range : bFile->DirtyRanges())
+		if (range.first < bFile->Length())
+			WriteRange(bFile, static_cast<long>(range.first), std::min(range.second, bFile->Length()) - range.first,
+				output, range.first);
+	output.flush();
+	if (!output)
+		THROW_RUNTIME("[ERROR] Writing file fail.");
+#else
+	auto output = open(filepath.c_str(), O_WRONLY | O_CLOEXEC);
+	if (output < 0)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+
+	try
+	{
+		struct stat status;
+		if (fstat(output, &status) != 0 || static_cast<size_t>(status.st_size) != bFile->Length())
+			THROW_RUNTIME("[ERROR] File size has changed.");
+
+		for (const auto& range : bFile->DirtyRanges())
+			if (range.first < bFile->Length())
+				WriteRange(bFile, -1, static_cast<long>(range.first),
+					std::min(range.second, bFile->Length()) - range.first, output, range.first);
+		if (fdatasync(output) != 0)
+			THROW_RUNTIME("[ERROR] Writing file fail.");
+	}
+	catch (const std::exception&)
+	{
+		close(output);
+		throw;
+	}
+
+	if (close(output) != 0)
+		THROW_RUNTIME("[ERROR] Writing file fail.");
+#endif
+}
+
+auto Utils::ReplaceFile(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath,
+	const bool& cloneUnchanged) -> void
+{
+	// Replace the file a symbolic link points to, not the link.
+	std::error_code error;
+	auto target = std::filesystem::canonical(filepath, error);
+	if (error)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	auto temporary = target;
+#ifdef _WIN32
+	// No kernel copy here, the whole data is written to the temporary file.
+	temporary += ".tmp";
+	CopyToFile(bFile, 0, bFile->Length(), temporary);
+	std::filesystem::rename(temporary, target, error);
+	if (error)
+	{
+		std::filesystem::remove(temporary, error);
+		THROW_RUNTIME("[ERROR] Replacing file fail.");
+	}
+#else
+	auto source = open(target.c_str(), O_RDONLY | O_CLOEXEC);
+	if (source < 0)
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+
+	// The temporary file is in the same directory, so the rename stays on one file system.
+	temporary += ".XXXXXX";
+	auto name = temporary.string();
+	auto output = mkostemp(name.data(), O_CLOEXEC);
+	if (output < 0)
+	{
+		close(source);
+		THROW_RUNTIME("[ERROR] Opening file fail.");
+	}
+
+	try
+	{
+		struct stat status;
+		if (fstat(source, &status) != 0)
+			THROW_RUNTIME("[ERROR] Reading file fail.");
+		auto sourceLength = static_cast<size_t>(status.st_size);
+		auto length = bFile->Length();
+
+		// Unchanged ranges are still the bytes of the file, clone them and write only the dirty ones.
+		auto write = [&](const size_t& begin, const size_t& end, const bool& dirty)
+		{
+			if (begin < end)
+				WriteRange(bFile, cloneUnchanged && !dirty && end <= sourceLength ? source : -1,
+					static_cast<long>(begin), end - begin, output, begin);
+		};
+		size_t position = 0;
+		for (const auto& range : bFile->DirtyRanges())
+		{
+			if (range.first >= length)
+				break;
+			write(position, range.first, false);
+			position = std::min(range.second, length);
+			write(range.first, position, true);
+		}
+		write(position, length, false);
 
-		return virtualAddress - section->VirtualAddress() + section->PointerToRawData();
+		// The owner goes first, changing it may clear the set-user-ID and set-group-ID bits.
+		if (fchown(output, status.st_uid, status.st_gid) != 0 || fchmod(output, status.st_mode & 07777) != 0 ||
+			fsync(output) != 0)
+			THROW_RUNTIME("[ERROR] Writing file fail.");
 	}
-	catch (const std::exception& ex)
+	catch (const std::exception&)
 	{
-		throw ex;
+		close(output);
+		close(source);
+		unlink(name.c_str());
+		throw;
 	}
+
+	close(source);
+	if (close(output) != 0 || rename(name.c_str(), target.c_str()) != 0)
+	{
+		unlink(name.c_str());
+		THROW_RUNTIME("[ERROR] Replacing file fail.");
+	}
+
+	// The rename is only durable once the directory entry is on disk.
+	auto directory = open(target.parent_path().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (directory < 0)
+		THROW_RUNTIME("[ERROR] Replacing file fail.");
+	auto synced = fsync(directory) == 0;
+	close(directory);
+	if (!synced)
+		THROW_RUNTIME("[ERROR] Replacing file fail.");
+#endif
+}
+
+auto Utils::IsSourceFile(const std::shared_ptr<IRaw>& bFile, const std::filesystem::path& filepath) -> std::optional<bool>
+{
+#ifdef _WIN32
+	return std::nullopt;
+#else
+	// An empty range asks for the file behind the data even when parts of it are patched.
+	auto descriptor = bFile->FileDescriptor(0, 0);
+	if (descriptor < 0)
+		return std::nullopt;
+
+	struct stat source, target;
+	if (fstat(descriptor, &source) != 0)
+		return std::nullopt;
+	if (stat(filepath.c_str(), &target) != 0)
+		return false;
+	return source.st_dev == target.st_dev && source.st_ino == target.st_ino;
+#endif
 }